@@ -3,6 +3,7 @@
 
 #include <samurai/cell_array.hpp>
 #include <samurai/cell_list.hpp>
+#include <samurai/flat_cell_list.hpp>
 
 static void BM_CellListConstruction_2D(benchmark::State& state)
 {
@@ -107,3 +108,116 @@ static void BM_CellList2CellArray_3D(benchmark::State& state)
 }
 
 BENCHMARK(BM_CellList2CellArray_3D)->Range(8, 8 << 18);
+
+static void BM_FlatCellListConstruction_2D(benchmark::State& state)
+{
+    constexpr std::size_t dim = 2;
+
+    std::size_t min_level = 1;
+    std::size_t max_level = 12;
+
+    samurai::FlatCellList<dim> cl;
+
+    for (auto _ : state)
+    {
+        // keeps the allocated memory, as the nested maps of CellList would not grow either for repeated cells
+        cl.clear();
+        for (std::size_t s = 0; s < state.range(0); ++s)
+        {
+            auto level = std::experimental::randint(min_level, max_level);
+            auto x     = std::experimental::randint(0, (100 << level) - 1);
+            auto y     = std::experimental::randint(0, (100 << level) - 1);
+
+            cl[level][{y}].add_point(x);
+        }
+    }
+}
+
+BENCHMARK(BM_FlatCellListConstruction_2D)->Range(8, 8 << 18);
+
+static void BM_FlatCellListConstruction_3D(benchmark::State& state)
+{
+    constexpr std::size_t dim = 3;
+
+    std::size_t min_level = 1;
+    std::size_t max_level = 12;
+
+    samurai::FlatCellList<dim> cl;
+
+    for (auto _ : state)
+    {
+        // keeps the allocated memory, as the nested maps of CellList would not grow either for repeated cells
+        cl.clear();
+        for (std::size_t s = 0; s < state.range(0); ++s)
+        {
+            auto level = std::experimental::randint(min_level, max_level);
+            auto x     = std::experimental::randint(0, (100 << level) - 1);
+            auto y     = std::experimental::randint(0, (100 << level) - 1);
+            auto z     = std::experimental::randint(0, (100 << level) - 1);
+
+            cl[level][{y, z}].add_point(x);
+        }
+    }
+}
+
+BENCHMARK(BM_FlatCellListConstruction_3D)->Range(8, 8 << 18);
+
+static void BM_FlatCellList2CellArray_2D(benchmark::State& state)
+{
+    constexpr std::size_t dim = 2;
+
+    std::size_t min_level = 1;
+    std::size_t max_level = 12;
+
+    samurai::CellArray<dim> ca;
+
+    for (auto _ : state)
+    {
+        // the flat list is sorted when the cell array is built, so that it is filled again at each iteration
+        state.PauseTiming();
+        samurai::FlatCellList<dim> cl;
+        for (std::size_t s = 0; s < state.range(0); ++s)
+        {
+            auto level = std::experimental::randint(min_level, max_level);
+            auto x     = std::experimental::randint(0, (100 << level) - 1);
+            auto y     = std::experimental::randint(0, (100 << level) - 1);
+
+            cl[level][{y}].add_point(x);
+        }
+        state.ResumeTiming();
+
+        ca = {cl};
+    }
+}
+
+BENCHMARK(BM_FlatCellList2CellArray_2D)->Range(8, 8 << 18);
+
+static void BM_FlatCellList2CellArray_3D(benchmark::State& state)
+{
+    constexpr std::size_t dim = 3;
+
+    std::size_t min_level = 1;
+    std::size_t max_level = 12;
+
+    samurai::CellArray<dim> ca;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        samurai::FlatCellList<dim> cl;
+        for (std::size_t s = 0; s < state.range(0); ++s)
+        {
+            auto level = std::experimental::randint(min_level, max_level);
+            auto x     = std::experimental::randint(0, (100 << level) - 1);
+            auto y     = std::experimental::randint(0, (100 << level) - 1);
+            auto z     = std::experimental::randint(0, (100 << level) - 1);
+
+            cl[level][{y, z}].add_point(x);
+        }
+        state.ResumeTiming();
+
+        ca = {cl};
+    }
+}
+
+BENCHMARK(BM_FlatCellList2CellArray_3D)->Range(8, 8 << 18);
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <xtensor/containers/xfixed.hpp>
+
+#include <samurai/bc.hpp>
+#include <samurai/box.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+
+/**
+ * Helpers shared by the benchmarks on meshes and fields.
+ *
+ * The benchmarks are templates on the dimension and on the number of field components,
+ * and take the level range of the mesh as arguments: state.range(0) is the min level, state.range(1) the max level.
+ */
+namespace bench
+{
+    template <std::size_t dim>
+    auto unit_box()
+    {
+        xt::xtensor_fixed<double, xt::xshape<dim>> min_corner;
+        xt::xtensor_fixed<double, xt::xshape<dim>> max_corner;
+        min_corner.fill(0.);
+        max_corner.fill(1.);
+        return samurai::Box<double, dim>(min_corner, max_corner);
+    }
+
+    inline std::size_t min_level(const benchmark::State& state)
+    {
+        return static_cast<std::size_t>(state.range(0));
+    }
+
+    inline std::size_t max_level(const benchmark::State& state)
+    {
+        return static_cast<std::size_t>(state.range(1));
+    }
+
+    /// Multiresolution mesh of the unit box on the level range of the benchmark.
+    template <std::size_t dim>
+    auto make_mesh(const benchmark::State& state, std::size_t stencil_size = 2)
+    {
+        auto config = samurai::mesh_config<dim>().min_level(min_level(state)).max_level(max_level(state)).max_stencil_size(stencil_size);
+        return samurai::mra::make_mesh(unit_box<dim>(), config);
+    }
+
+    /// Field with homogeneous Dirichlet boundary conditions.
+    template <std::size_t n_comp, class Mesh>
+    auto make_field(const std::string& name, Mesh& mesh)
+    {
+        if constexpr (n_comp == 1)
+        {
+            auto u = samurai::make_scalar_field<double>(name, mesh);
+            samurai::make_bc<samurai::Dirichlet<1>>(u);
+            return u;
+        }
+        else
+        {
+            auto u = samurai::make_vector_field<double, n_comp>(name, mesh);
+            samurai::make_bc<samurai::Dirichlet<1>>(u);
+            return u;
+        }
+    }
+
+    /// Smoothed front normal to the first direction, located at x = position.
+    template <class Field>
+    void init_front(Field& u, double position)
+    {
+        u.resize();
+        samurai::for_each_cell(u.mesh(),
+                               [&](const auto& cell)
+                               {
+                                   u[cell] = std::tanh((cell.center(0) - position) / 0.02);
+                               });
+    }
+
+    /// Adapts the mesh of u to the front located at position, then sets the exact values of u on the new mesh.
+    template <class Field>
+    void adapt_to_front(Field& u, double position)
+    {
+        init_front(u, position);
+        auto adaptation = samurai::make_MRAdapt(u);
+        adaptation(samurai::mra_config().epsilon(1e-3));
+        init_front(u, position);
+    }
+
+    /// Number of cells of the mesh, and processed cells per second.
+    template <class Mesh>
+    void set_counters(benchmark::State& state, const Mesh& mesh)
+    {
+        auto nb_cells              = static_cast<double>(mesh.nb_cells(Mesh::mesh_id_t::cells));
+        state.counters["nb cells"] = nb_cells;
+        state.counters["cells/s"]  = benchmark::Counter(nb_cells, benchmark::Counter::kIsIterationInvariantRate);
+    }
+} // namespace bench
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <samurai/interface.hpp>
+#include <samurai/schemes/fv.hpp>
+
+#include "benchmark_common.hpp"
+
+/**
+ * Explicit application of the WENO5 convection operator.
+ * The ghosts are updated once before the loop, so that only the flux computation is measured.
+ */
+template <std::size_t dim>
+static void BM_ConvectionWeno5(benchmark::State& state)
+{
+    auto mesh = bench::make_mesh<dim>(state, 6);
+    auto u    = bench::make_field<1>("u", mesh);
+    bench::adapt_to_front(u, 0.5);
+    samurai::update_ghost_mr(u);
+
+    samurai::VelocityVector<dim> velocity;
+    velocity.fill(1);
+    auto conv = samurai::make_convection_weno5<decltype(u)>(velocity);
+
+    for (auto _ : state)
+    {
+        auto result = conv(u);
+        benchmark::DoNotOptimize(result.array().data());
+    }
+    bench::set_counters(state, mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_ConvectionWeno5, 1)->Args({2, 12})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ConvectionWeno5, 2)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ConvectionWeno5, 3)->Args({2, 6})->Unit(benchmark::kMillisecond);
+
+/**
+ * Explicit application of the order 2 diffusion operator.
+ */
+template <std::size_t dim, std::size_t n_comp>
+static void BM_Diffusion(benchmark::State& state)
+{
+    auto mesh = bench::make_mesh<dim>(state);
+    auto u    = bench::make_field<n_comp>("u", mesh);
+    bench::adapt_to_front(u, 0.5);
+    samurai::update_ghost_mr(u);
+
+    samurai::DiffCoeff<dim> K;
+    K.fill(1.);
+    auto diff = samurai::make_diffusion_order2<decltype(u)>(K);
+
+    for (auto _ : state)
+    {
+        auto result = diff(u);
+        benchmark::DoNotOptimize(result.array().data());
+    }
+    bench::set_counters(state, mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_Diffusion, 1, 1)->Args({2, 12})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Diffusion, 2, 1)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Diffusion, 2, 3)->Args({2, 8})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Diffusion, 3, 1)->Args({2, 6})->Unit(benchmark::kMillisecond);
+
+/**
+ * Traversal of the interior interfaces, with a trivial flux computed from the two cells of each interface.
+ */
+template <std::size_t dim, std::size_t n_comp>
+static void BM_ForEachInteriorInterface(benchmark::State& state)
+{
+    auto mesh = bench::make_mesh<dim>(state);
+    auto u    = bench::make_field<n_comp>("u", mesh);
+    bench::adapt_to_front(u, 0.5);
+    samurai::update_ghost_mr(u);
+
+    double sum = 0;
+    for (auto _ : state)
+    {
+        samurai::for_each_interior_interface(mesh,
+                                             [&](const auto&, const auto& comput_cells)
+                                             {
+                                                 if constexpr (n_comp == 1)
+                                                 {
+                                                     sum += u[comput_cells[1]] - u[comput_cells[0]];
+                                                 }
+                                                 else
+                                                 {
+                                                     sum += u[comput_cells[1]][0] - u[comput_cells[0]][0];
+                                                 }
+                                             });
+    }
+    benchmark::DoNotOptimize(sum);
+    bench::set_counters(state, mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_ForEachInteriorInterface, 1, 1)->Args({2, 12})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ForEachInteriorInterface, 2, 1)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ForEachInteriorInterface, 2, 3)->Args({2, 8})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ForEachInteriorInterface, 3, 1)->Args({2, 6})->Unit(benchmark::kMillisecond);
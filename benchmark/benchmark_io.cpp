@@ -0,0 +1,60 @@
+#include <filesystem>
+
+#include <benchmark/benchmark.h>
+
+#include <samurai/io/hdf5.hpp>
+#include <samurai/io/restart.hpp>
+
+#include "benchmark_common.hpp"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    fs::path output_path()
+    {
+        auto path = fs::temp_directory_path() / "samurai_benchmark";
+        fs::create_directories(path);
+        return path;
+    }
+}
+
+template <std::size_t dim, std::size_t n_comp>
+static void BM_Hdf5Save(benchmark::State& state)
+{
+    auto mesh = bench::make_mesh<dim>(state);
+    auto u    = bench::make_field<n_comp>("u", mesh);
+    bench::adapt_to_front(u, 0.5);
+
+    auto path = output_path();
+    for (auto _ : state)
+    {
+        samurai::save(path, "bench_save", mesh, u);
+    }
+    bench::set_counters(state, mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_Hdf5Save, 1, 1)->Args({2, 12})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Hdf5Save, 2, 1)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Hdf5Save, 2, 3)->Args({2, 8})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Hdf5Save, 3, 1)->Args({2, 6})->Unit(benchmark::kMillisecond);
+
+template <std::size_t dim, std::size_t n_comp>
+static void BM_Hdf5Dump(benchmark::State& state)
+{
+    auto mesh = bench::make_mesh<dim>(state);
+    auto u    = bench::make_field<n_comp>("u", mesh);
+    bench::adapt_to_front(u, 0.5);
+
+    auto path = output_path();
+    for (auto _ : state)
+    {
+        samurai::dump(path, "bench_dump", mesh, u);
+    }
+    bench::set_counters(state, mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_Hdf5Dump, 1, 1)->Args({2, 12})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Hdf5Dump, 2, 1)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Hdf5Dump, 2, 3)->Args({2, 8})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Hdf5Dump, 3, 1)->Args({2, 6})->Unit(benchmark::kMillisecond);
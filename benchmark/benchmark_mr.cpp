@@ -0,0 +1,203 @@
+#include <benchmark/benchmark.h>
+
+#include <samurai/algorithm/graduation.hpp>
+#include <samurai/algorithm/update.hpp>
+#include <samurai/cell_array.hpp>
+#include <samurai/cell_list.hpp>
+
+#include "benchmark_common.hpp"
+
+template <std::size_t dim, std::size_t n_comp>
+static void BM_UpdateGhostMR(benchmark::State& state)
+{
+    auto mesh = bench::make_mesh<dim>(state);
+    auto u    = bench::make_field<n_comp>("u", mesh);
+    bench::adapt_to_front(u, 0.5);
+
+    for (auto _ : state)
+    {
+        samurai::update_ghost_mr(u);
+        benchmark::ClobberMemory();
+    }
+    bench::set_counters(state, mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_UpdateGhostMR, 1, 1)->Args({2, 12})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_UpdateGhostMR, 2, 1)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_UpdateGhostMR, 2, 3)->Args({2, 8})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_UpdateGhostMR, 3, 1)->Args({2, 6})->Unit(benchmark::kMillisecond);
+
+/**
+ * Adaptation to a front which moves by one finest cell at each iteration, as in a time loop.
+ */
+template <std::size_t dim, std::size_t n_comp>
+static void BM_MRAdaptMovingFront(benchmark::State& state)
+{
+    auto mesh = bench::make_mesh<dim>(state);
+    auto u    = bench::make_field<n_comp>("u", mesh);
+    bench::adapt_to_front(u, 0.25);
+
+    auto adaptation = samurai::make_MRAdapt(u);
+    auto mra_config = samurai::mra_config().epsilon(1e-3);
+    double dx       = mesh.min_cell_length();
+    double position = 0.25;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        position = (position + dx > 0.75) ? 0.25 : position + dx;
+        bench::init_front(u, position);
+        state.ResumeTiming();
+
+        adaptation(mra_config);
+    }
+    bench::set_counters(state, mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_MRAdaptMovingFront, 1, 1)->Args({2, 12})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MRAdaptMovingFront, 2, 1)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MRAdaptMovingFront, 2, 3)->Args({2, 8})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MRAdaptMovingFront, 3, 1)->Args({2, 6})->Unit(benchmark::kMillisecond);
+
+/**
+ * Transfer of a field to the mesh adapted to the front at the next position.
+ */
+template <std::size_t dim, std::size_t n_comp>
+static void BM_UpdateFields(benchmark::State& state)
+{
+    auto mesh = bench::make_mesh<dim>(state);
+    auto u    = bench::make_field<n_comp>("u", mesh);
+
+    bench::adapt_to_front(u, 0.5);
+    auto new_mesh = mesh;
+
+    bench::adapt_to_front(u, 0.45);
+    samurai::update_ghost_mr(u);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto v = u;
+        state.ResumeTiming();
+
+        samurai::update_fields(new_mesh, v);
+        benchmark::DoNotOptimize(v.array().data());
+    }
+    bench::set_counters(state, new_mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_UpdateFields, 1, 1)->Args({2, 12})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_UpdateFields, 2, 1)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_UpdateFields, 2, 3)->Args({2, 8})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_UpdateFields, 3, 1)->Args({2, 6})->Unit(benchmark::kMillisecond);
+
+/**
+ * Construction of the mesh adapted to a front at x = 0.7, either from the mesh adapted to the front at x = 0.3
+ * (from_reference = true, as after an adaptation) or from scratch.
+ * No level is the same in the two meshes, but the mirrored fronts give levels with the same numbers of intervals,
+ * so that the cells of each level are compared with those of the reference mesh: the difference between the two
+ * cases is the cost of these comparisons when nothing can be reused.
+ */
+template <std::size_t dim, bool from_reference>
+static void BM_MeshFromReference(benchmark::State& state)
+{
+    auto mesh       = bench::make_mesh<dim>(state);
+    using mesh_t    = decltype(mesh);
+    using mesh_id_t = typename mesh_t::mesh_id_t;
+    auto u          = bench::make_field<1>("u", mesh);
+
+    bench::adapt_to_front(u, 0.3);
+    auto ref_mesh = mesh;
+    bench::adapt_to_front(u, 0.7);
+    const auto& cells = mesh[mesh_id_t::cells];
+
+    for (auto _ : state)
+    {
+        if constexpr (from_reference)
+        {
+            mesh_t new_mesh{cells, ref_mesh};
+            benchmark::DoNotOptimize(new_mesh);
+        }
+        else
+        {
+            mesh_t new_mesh{cells, ref_mesh.cfg()};
+            benchmark::DoNotOptimize(new_mesh);
+        }
+    }
+    bench::set_counters(state, mesh);
+}
+
+BENCHMARK_TEMPLATE(BM_MeshFromReference, 1, true)->Args({2, 12})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MeshFromReference, 1, false)->Args({2, 12})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MeshFromReference, 2, true)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MeshFromReference, 2, false)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MeshFromReference, 3, true)->Args({2, 6})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MeshFromReference, 3, false)->Args({2, 6})->Unit(benchmark::kMillisecond);
+
+/**
+ * Cells at the min level, except around x = 0.5 where they are refined directly to the max level,
+ * so that make_graduation() has to add all the intermediate levels.
+ */
+template <std::size_t dim>
+auto make_ungraduated_cells(std::size_t min_level, std::size_t max_level)
+{
+    xt::xtensor_fixed<int, xt::xshape<dim>> min_corner;
+    xt::xtensor_fixed<int, xt::xshape<dim>> max_corner;
+    min_corner.fill(0);
+    max_corner.fill(1 << min_level);
+
+    samurai::CellArray<dim> coarse;
+    coarse[min_level] = {min_level, samurai::Box<int, dim>(min_corner, max_corner)};
+
+    int shift = static_cast<int>(max_level - min_level);
+    int front = 1 << (min_level - 1);
+
+    samurai::CellList<dim> cl;
+    samurai::for_each_interval(coarse,
+                               [&](std::size_t level, const auto& interval, const auto& index)
+                               {
+                                   for (auto i = interval.start; i < interval.end; ++i)
+                                   {
+                                       if (i != front)
+                                       {
+                                           cl[level][index].add_point(i);
+                                           continue;
+                                       }
+                                       // all the fine rows covering the coarse cell
+                                       xt::xtensor_fixed<int, xt::xshape<dim - 1>> fine_index;
+                                       for (int row = 0; row < (1 << (shift * static_cast<int>(dim - 1))); ++row)
+                                       {
+                                           int r = row;
+                                           for (std::size_t d = 0; d < dim - 1; ++d)
+                                           {
+                                               fine_index[d] = (index[d] << shift) + (r % (1 << shift));
+                                               r >>= shift;
+                                           }
+                                           cl[max_level][fine_index].add_interval({i << shift, (i + 1) << shift});
+                                       }
+                                   }
+                               });
+    return samurai::CellArray<dim>(cl);
+}
+
+template <std::size_t dim>
+static void BM_MakeGraduation(benchmark::State& state)
+{
+    auto cells = make_ungraduated_cells<dim>(bench::min_level(state), bench::max_level(state));
+
+    std::size_t nb_cells = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto ca = cells;
+        state.ResumeTiming();
+
+        samurai::make_graduation(ca);
+        nb_cells = ca.nb_cells();
+    }
+    state.counters["nb cells"] = static_cast<double>(nb_cells);
+}
+
+BENCHMARK_TEMPLATE(BM_MakeGraduation, 1)->Args({2, 12})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MakeGraduation, 2)->Args({2, 8})->Args({4, 10})->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MakeGraduation, 3)->Args({2, 6})->Unit(benchmark::kMillisecond);
@@ -2,8 +2,8 @@
 #include <benchmark/benchmark.h>
 #include <experimental/random>
 
-#include <xtensor/xfixed.hpp>
-#include <xtensor/xrandom.hpp>
+#include <xtensor/containers/xfixed.hpp>
+#include <xtensor/generators/xrandom.hpp>
 
 #include <samurai/algorithm.hpp>
 #include <samurai/cell_array.hpp>
@@ -13,8 +13,11 @@
 template <std::size_t dim>
 auto generate_mesh(int bound, std::size_t start_level, std::size_t max_level)
 {
-    samurai::Box<int, dim> box({-bound << start_level, -bound << start_level, -bound << start_level},
-                               {bound << start_level, bound << start_level, bound << start_level});
+    xt::xtensor_fixed<int, xt::xshape<dim>> min_corner;
+    xt::xtensor_fixed<int, xt::xshape<dim>> max_corner;
+    min_corner.fill(-bound << start_level);
+    max_corner.fill(bound << start_level);
+    samurai::Box<int, dim> box(min_corner, max_corner);
     samurai::CellArray<dim> ca;
 
     ca[start_level] = {start_level, box};
@@ -73,7 +76,7 @@ class MyFixture : public ::benchmark::Fixture
             for (std::size_t s = 0; s < state.range(0); ++s)
             {
                 auto level = std::experimental::randint(min_level, max_level);
-                std::array<int, dim> coord;
+                xt::xtensor_fixed<int, xt::xshape<dim>> coord;
                 for (auto& c : coord)
                 {
                     c = std::experimental::randint(-bound << level, (bound << level) - 1);
@@ -1,10 +1,12 @@
 #include <iostream>
 
 #include <benchmark/benchmark.h>
+
+#include <xtensor/containers/xfixed.hpp>
+
 #include <samurai/level_cell_array.hpp>
 #include <samurai/level_cell_list.hpp>
 #include <samurai/subset/node.hpp>
-#include <samurai/subset/node_op.hpp>
 
 template <std::size_t dim, class S>
 inline auto init_sets_1(S& set1, S& set2, S& set3)
@@ -1,3 +1,40 @@
+#include <string>
+#include <vector>
+
+#ifdef SAMURAI_WITH_MPI
+#include <boost/mpi.hpp>
+#endif
 #include <benchmark/benchmark.h>
 
-BENCHMARK_MAIN();
+int main(int argc, char* argv[])
+{
+#ifdef SAMURAI_WITH_MPI
+    boost::mpi::environment env(argc, argv);
+#endif
+
+    // The results are also written in JSON, so that they can be compared between releases
+    // (e.g. with tools/compare.py of Google Benchmark), unless another output file is given.
+    std::vector<char*> args(argv, argv + argc);
+    std::string json_out    = "--benchmark_out=bench_samurai.json";
+    std::string json_format = "--benchmark_out_format=json";
+    bool has_out            = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        has_out = has_out || std::string(argv[i]).starts_with("--benchmark_out=");
+    }
+    if (!has_out)
+    {
+        args.push_back(json_out.data());
+        args.push_back(json_format.data());
+    }
+    int nargs = static_cast<int>(args.size());
+
+    benchmark::Initialize(&nargs, args.data());
+    if (benchmark::ReportUnrecognizedArguments(nargs, args.data()))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
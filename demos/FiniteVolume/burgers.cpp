@@ -109,10 +109,7 @@ int main_dim(int argc, char* argv[])
     auto config = samurai::mesh_config<dim>().min_level(min_level).max_level(max_level).max_stencil_size(6);
     auto mesh   = samurai::mra::make_empty_mesh(config);
 
-    auto u    = samurai::make_vector_field<n_comp>("u", mesh);
-    auto u1   = samurai::make_vector_field<n_comp>("u1", mesh);
-    auto u2   = samurai::make_vector_field<n_comp>("u2", mesh);
-    auto unp1 = samurai::make_vector_field<n_comp>("unp1", mesh);
+    auto u = samurai::make_vector_field<n_comp>("u", mesh);
 
     if (restart_file.empty())
     {
@@ -210,12 +207,12 @@ int main_dim(int argc, char* argv[])
         }
     }
 
-    u1.copy_bc_from(u);
-    u2.copy_bc_from(u);
-
     double cst = dim == 1 ? 0.5 : 1; // if dim == 1, we want f(u) = (1/2)*u^2
     auto conv  = cst * samurai::make_convection_weno5<decltype(u)>();
 
+    // RK3 time scheme
+    auto rk3 = samurai::make_explicit_runge_kutta(conv, u, samurai::RungeKuttaMethod::SSPRK3);
+
     //--------------------//
     //   Time iteration   //
     //--------------------//
@@ -248,9 +245,6 @@ int main_dim(int argc, char* argv[])
 
         // Mesh adaptation
         MRadaptation(mra_config);
-        u1.resize();
-        u2.resize();
-        unp1.resize();
 
         // Boundary conditions
         if (dim == 1 && init_sol == "linear")
@@ -263,13 +257,8 @@ int main_dim(int argc, char* argv[])
                                                     });
         }
 
-        // RK3 time scheme
-        u1   = u - dt * conv(u);
-        u2   = 3. / 4 * u + 1. / 4 * (u1 - dt * conv(u1));
-        unp1 = 1. / 3 * u + 2. / 3 * (u2 - dt * conv(u2));
-
-        // u <-- unp1
-        samurai::swap(u, unp1);
+        // u <-- u(t + dt)
+        rk3.step(dt);
 
         // Save the result
         if (t >= static_cast<double>(nsave) * dt_save || t == Tf)
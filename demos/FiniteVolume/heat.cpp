@@ -78,6 +78,7 @@ int main(int argc, char* argv[])
     }
     std::string init_sol = "dirac";
     double diff_coeff    = 1;
+    bool dirichlet_bc    = false;
 
     // Time integration
     double Tf            = 1.;
@@ -96,6 +97,7 @@ int main(int argc, char* argv[])
     app.add_option("--right", right_box, "The right border of the box")->capture_default_str()->group("Simulation parameters");
     app.add_option("--init-sol", init_sol, "Initial solution: dirac/crenel")->capture_default_str()->group("Simulation parameters");
     app.add_option("--diff-coeff", diff_coeff, "Diffusion coefficient")->capture_default_str()->group("Simulation parameters");
+    app.add_flag("--dirichlet", dirichlet_bc, "Dirichlet BCs from the exact solution (dirac only)")->group("Simulation parameters");
     app.add_flag("--explicit", explicit_scheme, "Explicit scheme instead of implicit")->group("Simulation parameters");
     app.add_option("--Ti", t0, "Initial time")->capture_default_str()->group("Simulation parameters");
     app.add_option("--Tf", Tf, "Final time")->capture_default_str()->group("Simulation parameters");
@@ -155,8 +157,22 @@ int main(int argc, char* argv[])
 
     auto unp1 = samurai::make_scalar_field<double>("unp1", mesh);
 
-    samurai::make_bc<samurai::Neumann<1>>(u, 0.);
-    samurai::make_bc<samurai::Neumann<1>>(unp1, 0.);
+    double t = t0;
+    if (dirichlet_bc)
+    {
+        // the boundary values are those of the exact solution at the current time
+        auto exact_bc = [&](const auto&, const auto&, const auto& coords)
+        {
+            return exact_solution(coords, t, diff_coeff);
+        };
+        samurai::make_bc<samurai::Dirichlet<1>>(u, exact_bc);
+        samurai::make_bc<samurai::Dirichlet<1>>(unp1, exact_bc);
+    }
+    else
+    {
+        samurai::make_bc<samurai::Neumann<1>>(u, 0.);
+        samurai::make_bc<samurai::Neumann<1>>(unp1, 0.);
+    }
 
     samurai::DiffCoeff<dim> K;
     K.fill(diff_coeff);
@@ -192,7 +208,6 @@ int main(int argc, char* argv[])
         PCSetType(pc, PCLU);         // (equiv. '-pc_type lu')
     };
 
-    double t = t0;
     while (t != Tf)
     {
         // Move to next timestep
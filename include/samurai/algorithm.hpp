@@ -6,7 +6,9 @@
 #ifdef SAMURAI_WITH_OPENMP
 #include <omp.h>
 #endif
+#include <array>
 #include <type_traits>
+#include <vector>
 
 #include <xtensor/containers/xfixed.hpp>
 #include <xtensor/views/xview.hpp>
@@ -33,7 +35,10 @@ namespace samurai
     enum class Run
     {
         Sequential,
-        Parallel
+        Parallel,
+        // Parallel, the intervals of a row are never processed at the same time as the intervals of the adjacent rows
+        // (see coloured_parallel_for_each_meshinterval())
+        ParallelColoured
     };
 
     enum class Get
@@ -189,6 +194,40 @@ namespace samurai
             });
     }
 
+    /**
+     * Parallel loop over the intervals of the set, in successive passes: one per parity of the y/z coordinates of the rows
+     * (1 pass in 1D, 2 in 2D, 4 in 3D).
+     * Two intervals processed in the same pass are neither on adjacent rows, nor on two fine rows sharing the same coarse row,
+     * so that f can write into the cells on both sides of an interface (of same level or at a level jump) without
+     * atomic operations.
+     */
+    template <class MeshIntervalType, class SetType, class Func>
+    SAMURAI_INLINE void coloured_parallel_for_each_meshinterval(SetType& set, Func&& f)
+    {
+        std::array<std::vector<MeshIntervalType>, 4> coloured_intervals; // 2^(dim-1) colours, dim <= 3
+        set(
+            [&](const auto& i, const auto& index)
+            {
+                std::size_t colour = 0;
+                for (std::size_t d = 0; d < index.size(); ++d)
+                {
+                    colour |= static_cast<std::size_t>(index[d] & 1) << d;
+                }
+                auto& mesh_interval = coloured_intervals[colour].emplace_back(set.level());
+                mesh_interval.i     = i;
+                mesh_interval.index = index;
+            });
+
+        for (auto& intervals : coloured_intervals)
+        {
+#pragma omp parallel for schedule(dynamic)
+            for (std::size_t k = 0; k < intervals.size(); ++k)
+            {
+                f(intervals[k]);
+            }
+        }
+    }
+
     template <class MeshIntervalType, Run run_type, class SetType, class Func>
     SAMURAI_INLINE void for_each_meshinterval(SetType& set, Func&& f)
     {
@@ -196,6 +235,10 @@ namespace samurai
         {
             parallel_for_each_meshinterval<MeshIntervalType>(set, std::forward<Func>(f));
         }
+        else if constexpr (run_type == Run::ParallelColoured)
+        {
+            coloured_parallel_for_each_meshinterval<MeshIntervalType>(set, std::forward<Func>(f));
+        }
         else
         {
             for_each_meshinterval<MeshIntervalType>(set, std::forward<Func>(f));
@@ -463,6 +506,23 @@ namespace samurai
     SAMURAI_INLINE auto
     find(const LevelCellArray<dim, TInterval>& lca, const xt::xtensor_fixed<coord_index_t, xt::xshape<dim>>& coord) -> index_t
     {
+        if constexpr (dim > 1)
+        {
+            // the row of the outermost coordinate is given by the dense index, if any
+            if (const auto* outer_rows = lca.outer_row_index())
+            {
+                auto row = outer_rows->row(coord[dim - 1]);
+                if (row == outer_rows->npos)
+                {
+                    return -1;
+                }
+                return detail::find_impl(lca,
+                                         lca.offsets(dim - 1)[row],
+                                         lca.offsets(dim - 1)[row + 1],
+                                         coord,
+                                         std::integral_constant<std::size_t, dim - 2>{});
+            }
+        }
         return detail::find_impl(lca, 0, lca[dim - 1].size(), coord, std::integral_constant<std::size_t, dim - 1>{});
     }
 
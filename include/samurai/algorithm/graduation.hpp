@@ -9,6 +9,7 @@
 #include "../array_of_interval_and_point.hpp"
 #include "../cell_flag.hpp"
 #include "../mesh.hpp"
+#include "../profiling.hpp"
 #include "../stencil.hpp"
 #include "../subset/node.hpp"
 #include "../subset/utils.hpp"
@@ -129,6 +130,7 @@ namespace samurai
     template <class Tag, class Stencil>
     void graduation(Tag& tag, const Stencil& stencil)
     {
+        SAMURAI_PROFILE_REGION("graduation");
         auto& mesh      = tag.mesh();
         using mesh_t    = typename Tag::mesh_t;
         using mesh_id_t = typename mesh_t::mesh_id_t;
@@ -499,6 +501,7 @@ namespace samurai
                            const int max_stencil_radius = 1 // half of width of the numerical scheme's stencil.
     )
     {
+        SAMURAI_PROFILE_REGION("graduation");
         using ca_type    = CellArray<dim, TInterval, max_size>;
         using coord_type = typename ca_type::lca_type::coord_type;
 
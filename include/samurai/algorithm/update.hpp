@@ -4,6 +4,9 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <utility>
 
 #include <xtensor/containers/xfixed.hpp>
 
@@ -11,10 +14,12 @@
 #include "../bc/apply_field_bc.hpp"
 #include "../concepts.hpp"
 #include "../field.hpp"
+#include "../flat_cell_list.hpp"
+#include "../memory.hpp"
 #include "../numeric/prediction.hpp"
 #include "../numeric/projection.hpp"
+#include "../profiling.hpp"
 #include "../subset/node.hpp"
-#include "../timers.hpp"
 #include "graduation.hpp"
 #include "utils.hpp"
 
@@ -524,56 +529,92 @@ namespace samurai
         update_ghost_mr_if_needed(other_fields...);
     }
 
-    template <class Field, class... Fields>
-    void update_ghost_mr(Field& field, Fields&... other_fields)
+    namespace detail
     {
-        using mesh_id_t                  = typename Field::mesh_t::mesh_id_t;
-        constexpr std::size_t pred_order = Field::mesh_t::config::prediction_stencil_radius;
-
-        times::timers.start("ghost update");
-
-        auto& mesh            = field.mesh();
-        auto max_level        = mesh.max_level();
-        std::size_t min_level = 0;
+        /**
+         * All the steps of update_ghost_mr() except the last exchange of the MPI ghosts at max_level,
+         * on which no other step depends.
+         */
+        template <class Field, class... Fields>
+        void update_ghost_mr_except_last_exchange(Field& field, Fields&... other_fields)
+        {
+            using mesh_id_t                  = typename Field::mesh_t::mesh_id_t;
+            constexpr std::size_t pred_order = Field::mesh_t::config::prediction_stencil_radius;
 
-        update_outer_ghosts(max_level, field, other_fields...);
+            auto& mesh            = field.mesh();
+            auto max_level        = mesh.max_level();
+            std::size_t min_level = 0;
 
-        for (std::size_t level = max_level; level > min_level; --level)
-        {
-            update_ghost_periodic(level, field, other_fields...);
-            update_ghost_subdomains(level, field, other_fields...);
+            update_outer_ghosts(max_level, field, other_fields...);
 
-            auto set_at_levelm1 = intersection(mesh[mesh_id_t::reference][level], mesh[mesh_id_t::proj_cells][level - 1]).on(level - 1);
-            set_at_levelm1.apply_op(variadic_projection(field, other_fields...));
+            for (std::size_t level = max_level; level > min_level; --level)
+            {
+                update_ghost_periodic(level, field, other_fields...);
+                update_ghost_subdomains(level, field, other_fields...);
+
+                // these sets only depend on the mesh: they are evaluated once and kept until the cells change
+                const auto& set_at_levelm1 = mesh.subset_cache().get("update_ghost_mr/projection",
+                                                                     level - 1,
+                                                                     [&]()
+                                                                     {
+                                                                         return intersection(mesh[mesh_id_t::reference][level],
+                                                                                             mesh[mesh_id_t::proj_cells][level - 1])
+                                                                             .on(level - 1);
+                                                                     });
+                for_each_interval(set_at_levelm1, variadic_projection(field, other_fields...));
+
+                update_outer_ghosts(level - 1, field, other_fields...);
+            }
 
-            update_outer_ghosts(level - 1, field, other_fields...);
-        }
+            if (min_level > 0 && min_level != max_level)
+            {
+                update_ghost_periodic(min_level - 1, field, other_fields...);
+                update_ghost_subdomains(min_level - 1, field, other_fields...);
+                update_outer_ghosts(min_level - 1, field, other_fields...);
+            }
+            update_ghost_periodic(min_level, field, other_fields...);
+            if (min_level < max_level)
+            {
+                update_ghost_subdomains(min_level, field, other_fields...);
+            }
 
-        if (min_level > 0 && min_level != max_level)
-        {
-            update_ghost_periodic(min_level - 1, field, other_fields...);
-            update_ghost_subdomains(min_level - 1, field, other_fields...);
-            update_outer_ghosts(min_level - 1, field, other_fields...);
+            for (std::size_t level = min_level + 1; level <= max_level; ++level)
+            {
+                const auto& expr = mesh.subset_cache().get("update_ghost_mr/prediction",
+                                                           level,
+                                                           [&]()
+                                                           {
+                                                               auto pred_ghosts = difference(mesh[mesh_id_t::all_cells][level],
+                                                                                             union_(mesh[mesh_id_t::cells][level],
+                                                                                                    mesh[mesh_id_t::proj_cells][level]));
+                                                               return intersection(pred_ghosts,
+                                                                                   mesh.subdomain(),
+                                                                                   mesh[mesh_id_t::all_cells][level - 1])
+                                                                   .on(level);
+                                                           });
+
+                for_each_interval(expr, variadic_prediction<pred_order, false>(field, other_fields...));
+                update_ghost_periodic(level, field, other_fields...);
+                if (level < max_level)
+                {
+                    update_ghost_subdomains(level, field, other_fields...);
+                }
+            }
         }
-        update_ghost_periodic(min_level, field, other_fields...);
-        update_ghost_subdomains(min_level, field, other_fields...);
+    }
 
-        for (std::size_t level = min_level + 1; level <= max_level; ++level)
-        {
-            auto pred_ghosts = difference(mesh[mesh_id_t::all_cells][level],
-                                          union_(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::proj_cells][level]));
-            auto expr        = intersection(pred_ghosts, mesh.subdomain(), mesh[mesh_id_t::all_cells][level - 1]).on(level);
+    template <class Field, class... Fields>
+    void update_ghost_mr(Field& field, Fields&... other_fields)
+    {
+        SAMURAI_PROFILE_REGION("ghost update");
+        profiling::add_ghost_bytes(field, other_fields...);
 
-            expr.apply_op(variadic_prediction<pred_order, false>(field, other_fields...));
-            update_ghost_periodic(level, field, other_fields...);
-            update_ghost_subdomains(level, field, other_fields...);
-        }
+        detail::update_ghost_mr_except_last_exchange(field, other_fields...);
+        update_ghost_subdomains(field.mesh().max_level(), field, other_fields...);
         // save(fs::current_path(), "update_ghosts", {true, true}, mesh, field);
 
         field.ghosts_updated() = true;
         ((other_fields.ghosts_updated() = true), ...);
-
-        times::timers.stop("ghost update");
     }
 
     SAMURAI_INLINE void update_ghost_mr()
@@ -597,20 +638,20 @@ namespace samurai
         update_ghost_mr(fields.elements());
     }
 
-    template <bool to_send, class Field>
-    auto outer_subdomain_corner(std::size_t level, Field& field, const typename Field::mesh_t::mpi_subdomain_t& neighbour)
+    template <bool to_send, class Mesh>
+        requires mesh_like<Mesh>
+    auto outer_subdomain_corner(std::size_t level, const Mesh& mesh, const typename Mesh::mpi_subdomain_t& neighbour)
     {
-        using mesh_id_t  = typename Field::mesh_t::mesh_id_t;
-        using lca_t      = typename Field::mesh_t::lca_type;
-        using interval_t = typename Field::mesh_t::interval_t;
+        using mesh_id_t  = typename Mesh::mesh_id_t;
+        using lca_t      = typename Mesh::lca_type;
+        using interval_t = typename Mesh::interval_t;
         using coord_t    = typename lca_t::coord_type;
 
-        int ghost_width = field.mesh().ghost_width();
+        int ghost_width = mesh.ghost_width();
 
         ArrayOfIntervalAndPoint<interval_t, coord_t> interval_list;
 
-        auto& mesh = field.mesh();
-        for_each_cartesian_direction<Field::dim>(
+        for_each_cartesian_direction<Mesh::dim>(
             [&](auto bdry_direction_index, const auto& bdry_direction)
             {
                 if (!mesh.is_periodic(bdry_direction_index))
@@ -646,53 +687,76 @@ namespace samurai
         return lca;
     }
 
-    template <class Field>
-    void update_ghost_subdomains([[maybe_unused]] std::size_t level, [[maybe_unused]] Field& field)
+    template <bool to_send, class Field>
+        requires field_like<Field>
+    auto outer_subdomain_corner(std::size_t level, Field& field, const typename Field::mesh_t::mpi_subdomain_t& neighbour)
     {
-#ifdef SAMURAI_WITH_MPI
-        using mesh_t    = typename Field::mesh_t;
-        using value_t   = typename Field::value_type;
-        using mesh_id_t = typename mesh_t::mesh_id_t;
-        std::vector<mpi::request> req;
+        return outer_subdomain_corner<to_send>(level, field.mesh(), neighbour);
+    }
 
-        auto& mesh = field.mesh();
-        mpi::communicator world;
-        std::vector<std::vector<value_t>> to_send(mesh.mpi_neighbourhood().size());
+#ifdef SAMURAI_WITH_MPI
+    namespace detail
+    {
+        /**
+         * Communicator dedicated to the ghost exchanges, so that their messages (tagged by level)
+         * never match the ones of the other communications.
+         */
+        SAMURAI_INLINE const mpi::communicator& ghost_exchange_communicator()
+        {
+            static mpi::communicator comm(MPI_COMM_WORLD, mpi::comm_duplicate);
+            return comm;
+        }
 
-        std::size_t i_neigh = 0;
-        for (auto& neighbour : mesh.mpi_neighbourhood())
+        /**
+         * Computes the ranges of cell indices exchanged with each neighbour to update the ghosts at the given level:
+         * the interface with the neighbouring subdomain followed by the outer corners of the subdomains.
+         */
+        template <class Mesh>
+        void build_ghost_exchange_plan(Mesh& mesh, std::size_t level, typename Mesh::ghost_exchange_plan_t& plan)
         {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
+            using mesh_id_t = typename Mesh::mesh_id_t;
+            using index_t   = typename Mesh::index_t;
+
+            plan.neighbours.clear();
+
+            auto add_range = [&](auto& ranges, std::size_t& n_cells, const auto& i, const auto& index)
             {
-                auto out_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                  neighbour.mesh[mesh_id_t::reference][level],
-                                                  mesh.subdomain())
+                index_t start = mesh.get_interval(level, i, index).index + i.start;
+                index_t end   = start + static_cast<index_t>(i.size());
+                // Contiguous ranges are merged
+                if (!ranges.empty() && ranges.back()[1] == start)
+                {
+                    ranges.back()[1] = end;
+                }
+                else
+                {
+                    ranges.push_back({start, end});
+                }
+                n_cells += i.size();
+            };
+
+            for (auto& neighbour : mesh.mpi_neighbourhood())
+            {
+                if (mesh[mesh_id_t::reference][level].empty() || neighbour.mesh[mesh_id_t::reference][level].empty())
+                {
+                    continue;
+                }
+                auto& neighbour_plan = plan.neighbours.emplace_back();
+                neighbour_plan.rank  = neighbour.rank;
+
+                auto out_interface = intersection(mesh[mesh_id_t::reference][level], neighbour.mesh[mesh_id_t::reference][level], mesh.subdomain())
                                          .on(level);
                 out_interface(
                     [&](const auto& i, const auto& index)
                     {
-                        std::copy(field(level, i, index).begin(), field(level, i, index).end(), std::back_inserter(to_send[i_neigh]));
-                    });
-                auto subdomain_corners = outer_subdomain_corner<true>(level, field, neighbour);
-                for_each_interval(
-                    subdomain_corners,
-                    [&](const auto, const auto& i, const auto& index)
-                    {
-                        std::copy(field(level, i, index).begin(), field(level, i, index).end(), std::back_inserter(to_send[i_neigh]));
+                        add_range(neighbour_plan.send_ranges, neighbour_plan.n_send_cells, i, index);
                     });
+                for_each_interval(outer_subdomain_corner<true>(level, mesh, neighbour),
+                                  [&](const auto, const auto& i, const auto& index)
+                                  {
+                                      add_range(neighbour_plan.send_ranges, neighbour_plan.n_send_cells, i, index);
+                                  });
 
-                req.push_back(world.isend(neighbour.rank, neighbour.rank, to_send[i_neigh++]));
-            }
-        }
-
-        for (auto& neighbour : mesh.mpi_neighbourhood())
-        {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
-            {
-                std::vector<value_t> to_recv;
-                std::ptrdiff_t count = 0;
-
-                world.recv(neighbour.rank, world.rank(), to_recv);
                 auto in_interface = intersection(neighbour.mesh[mesh_id_t::reference][level],
                                                  mesh[mesh_id_t::reference][level],
                                                  neighbour.mesh.subdomain())
@@ -700,47 +764,400 @@ namespace samurai
                 in_interface(
                     [&](const auto& i, const auto& index)
                     {
-                        std::copy(to_recv.begin() + count,
-                                  to_recv.begin() + count + static_cast<ptrdiff_t>(i.size() * Field::n_comp),
-                                  field(level, i, index).begin());
-                        count += static_cast<ptrdiff_t>(i.size() * Field::n_comp);
+                        add_range(neighbour_plan.recv_ranges, neighbour_plan.n_recv_cells, i, index);
                     });
-                auto subdomain_corners = outer_subdomain_corner<false>(level, field, neighbour);
-                for_each_interval(subdomain_corners,
+                for_each_interval(outer_subdomain_corner<false>(level, mesh, neighbour),
                                   [&](const auto, const auto& i, const auto& index)
                                   {
-                                      std::copy(to_recv.begin() + count,
-                                                to_recv.begin() + count + static_cast<ptrdiff_t>(i.size() * Field::n_comp),
-                                                field(level, i, index).begin());
-                                      count += static_cast<ptrdiff_t>(i.size() * Field::n_comp);
+                                      add_range(neighbour_plan.recv_ranges, neighbour_plan.n_recv_cells, i, index);
                                   });
             }
+            plan.is_built = true;
         }
-        mpi::wait_all(req.begin(), req.end());
+
+        template <class Mesh>
+        auto& get_ghost_exchange_plan(Mesh& mesh, std::size_t level)
+        {
+            auto& plan = mesh.ghost_exchange_plan(level);
+            if (!plan.is_built)
+            {
+                build_ghost_exchange_plan(mesh, level, plan);
+            }
+            return plan;
+        }
+
+        /**
+         * Calls f(offset, n_values) for each contiguous block of values of the field in the ranges of cell indices,
+         * the offset being relative to the beginning of the storage: one block per range if the components of a cell
+         * are contiguous, one block per component and per range otherwise.
+         */
+        template <class Field, class Ranges, class Func>
+        void for_each_contiguous_block(const Field& field, const Ranges& ranges, Func&& f)
+        {
+            using data_type              = std::decay_t<decltype(field.storage())>;
+            constexpr std::size_t n_comp = Field::n_comp;
+
+            for (const auto& [start, end] : ranges)
+            {
+                auto first    = static_cast<std::size_t>(start);
+                auto n_values = static_cast<std::size_t>(end - start);
+                if constexpr (data_type::contiguous_components)
+                {
+                    f(first * n_comp, n_values * n_comp);
+                }
+                else
+                {
+                    std::size_t n_items = static_cast<std::size_t>(field.storage().data().size()) / n_comp;
+                    for (std::size_t c = 0; c < n_comp; ++c)
+                    {
+                        f(c * n_items + first, n_values);
+                    }
+                }
+            }
+        }
+
+        template <class Field, class Ranges>
+        std::byte* gather_ghost_values(const Field& field, const Ranges& ranges, std::byte* buffer)
+        {
+            using value_t    = typename Field::value_type;
+            const auto* data = field.storage().data().data();
+            for_each_contiguous_block(field,
+                                      ranges,
+                                      [&](std::size_t offset, std::size_t n_values)
+                                      {
+                                          std::memcpy(buffer, data + offset, n_values * sizeof(value_t));
+                                          buffer += n_values * sizeof(value_t);
+                                      });
+            return buffer;
+        }
+
+        template <class Field, class Ranges>
+        const std::byte* scatter_ghost_values(Field& field, const Ranges& ranges, const std::byte* buffer)
+        {
+            using value_t = typename Field::value_type;
+            auto* data    = field.storage().data().data();
+            for_each_contiguous_block(field,
+                                      ranges,
+                                      [&](std::size_t offset, std::size_t n_values)
+                                      {
+                                          std::memcpy(data + offset, buffer, n_values * sizeof(value_t));
+                                          buffer += n_values * sizeof(value_t);
+                                      });
+            return buffer;
+        }
+    }
 #endif
+
+#ifdef SAMURAI_WITH_MPI
+    namespace detail
+    {
+        /**
+         * Exchange of the MPI ghosts of several fields at several levels, with one message per neighbour:
+         * for each level (in increasing order), the values of each field are packed one after the other.
+         * The buffers of the plan of the first level shared with a neighbour are borrowed during the exchange.
+         */
+        template <class Mesh>
+        class GhostExchange
+        {
+          public:
+
+            using plan_t           = typename Mesh::ghost_exchange_plan_t;
+            using neighbour_plan_t = typename plan_t::neighbour_plan;
+
+            GhostExchange(Mesh& mesh, std::size_t min_level, std::size_t max_level, int tag)
+                : m_tag(tag)
+            {
+                for (std::size_t level = min_level; level <= max_level; ++level)
+                {
+                    for (auto& neighbour_plan : get_ghost_exchange_plan(mesh, level).neighbours)
+                    {
+                        auto it = std::find_if(m_messages.begin(),
+                                               m_messages.end(),
+                                               [&](const auto& message)
+                                               {
+                                                   return message.rank == neighbour_plan.rank;
+                                               });
+                        if (it == m_messages.end())
+                        {
+                            it       = m_messages.insert(m_messages.end(), message_t{});
+                            it->rank = neighbour_plan.rank;
+                        }
+                        it->parts.push_back(&neighbour_plan);
+                        it->n_send_cells += neighbour_plan.n_send_cells;
+                        it->n_recv_cells += neighbour_plan.n_recv_cells;
+                    }
+                }
+            }
+
+            GhostExchange(const GhostExchange&)            = delete;
+            GhostExchange& operator=(const GhostExchange&) = delete;
+            GhostExchange(GhostExchange&&) noexcept        = default;
+            GhostExchange& operator=(GhostExchange&&)      = delete;
+
+            template <class... Fields>
+            void start(Fields&... fields)
+            {
+                constexpr std::size_t cell_size = ((Fields::n_comp * sizeof(typename Fields::value_type)) + ...);
+                const auto& comm                = ghost_exchange_communicator();
+
+                m_recv_requests.resize(m_messages.size());
+                m_send_requests.resize(m_messages.size());
+                for (std::size_t m = 0; m < m_messages.size(); ++m)
+                {
+                    auto& message = m_messages[m];
+                    std::swap(message.recv_buffer, message.parts.front()->recv_buffer);
+                    message.recv_buffer.resize(message.n_recv_cells * cell_size);
+                    MPI_Irecv(message.recv_buffer.data(),
+                              static_cast<int>(message.recv_buffer.size()),
+                              MPI_BYTE,
+                              message.rank,
+                              m_tag,
+                              comm,
+                              &m_recv_requests[m]);
+                }
+                for (std::size_t m = 0; m < m_messages.size(); ++m)
+                {
+                    auto& message = m_messages[m];
+                    std::swap(message.send_buffer, message.parts.front()->send_buffer);
+                    message.send_buffer.resize(message.n_send_cells * cell_size);
+                    auto* buffer = message.send_buffer.data();
+                    for (const auto* part : message.parts)
+                    {
+                        ((buffer = gather_ghost_values(fields, part->send_ranges, buffer)), ...);
+                    }
+                    MPI_Isend(message.send_buffer.data(),
+                              static_cast<int>(message.send_buffer.size()),
+                              MPI_BYTE,
+                              message.rank,
+                              m_tag,
+                              comm,
+                              &m_send_requests[m]);
+                }
+            }
+
+            template <class... Fields>
+            void finish(Fields&... fields)
+            {
+                // The ghosts are filled in the order of arrival of the messages
+                for (std::size_t k = 0; k < m_messages.size(); ++k)
+                {
+                    int m;
+                    MPI_Waitany(static_cast<int>(m_recv_requests.size()), m_recv_requests.data(), &m, MPI_STATUS_IGNORE);
+                    auto& message      = m_messages[static_cast<std::size_t>(m)];
+                    const auto* buffer = message.recv_buffer.data();
+                    for (const auto* part : message.parts)
+                    {
+                        ((buffer = scatter_ghost_values(fields, part->recv_ranges, buffer)), ...);
+                    }
+                }
+                MPI_Waitall(static_cast<int>(m_send_requests.size()), m_send_requests.data(), MPI_STATUSES_IGNORE);
+
+                for (auto& message : m_messages)
+                {
+                    std::swap(message.send_buffer, message.parts.front()->send_buffer);
+                    std::swap(message.recv_buffer, message.parts.front()->recv_buffer);
+                }
+            }
+
+          private:
+
+            struct message_t
+            {
+                int rank = 0;
+                std::vector<neighbour_plan_t*> parts;
+                std::size_t n_send_cells = 0;
+                std::size_t n_recv_cells = 0;
+                std::vector<std::byte> send_buffer;
+                std::vector<std::byte> recv_buffer;
+            };
+
+            int m_tag;
+            std::vector<message_t> m_messages;
+            std::vector<MPI_Request> m_recv_requests;
+            std::vector<MPI_Request> m_send_requests;
+        };
     }
+#endif
 
+    /**
+     * Updates the MPI ghosts of the fields at the given level, with one message per neighbour for all the fields.
+     */
     template <class Field, class... Fields>
-    void update_ghost_subdomains(std::size_t level, Field& field, Fields&... other_fields)
+        requires field_like<Field> && (field_like<Fields> && ...)
+    void update_ghost_subdomains([[maybe_unused]] std::size_t level, [[maybe_unused]] Field& field, [[maybe_unused]] Fields&... other_fields)
     {
-        update_ghost_subdomains(level, field);
-        update_ghost_subdomains(level, other_fields...);
+#ifdef SAMURAI_WITH_MPI
+        detail::GhostExchange exchange(field.mesh(), level, level, static_cast<int>(level));
+        exchange.start(field, other_fields...);
+        exchange.finish(field, other_fields...);
+#endif
     }
 
-    template <class Field>
-    void update_ghost_subdomains([[maybe_unused]] Field& field)
+    template <class... T>
+    void update_ghost_subdomains(std::size_t level, Field_tuple<T...>& fields)
+    {
+        std::apply(
+            [level](T&... tupleArgs)
+            {
+                update_ghost_subdomains(level, tupleArgs...);
+            },
+            fields.elements());
+    }
+
+    /**
+     * Ghost update in progress, returned by begin_update_ghosts().
+     * The MPI ghosts at max_level of all the fields are exchanged in one message per neighbour;
+     * their values must not be read before end_update_ghosts() (or wait()) has been called.
+     * The mesh must not change in between.
+     */
+    template <class... Fields>
+    class GhostUpdateHandle
     {
+      public:
+
+        explicit GhostUpdateHandle(Fields&... fields);
+
+        GhostUpdateHandle(const GhostUpdateHandle&)            = delete;
+        GhostUpdateHandle& operator=(const GhostUpdateHandle&) = delete;
+        GhostUpdateHandle(GhostUpdateHandle&& other) noexcept;
+        GhostUpdateHandle& operator=(GhostUpdateHandle&&) = delete;
+
+        ~GhostUpdateHandle();
+
+        bool is_pending() const;
+        void wait();
+
+      private:
+
+        using mesh_t = typename std::tuple_element_t<0, std::tuple<Fields...>>::mesh_t;
+
+        std::tuple<Fields&...> m_fields;
+        bool m_pending = true;
 #ifdef SAMURAI_WITH_MPI
-        mpi::communicator world;
-        auto& mesh     = field.mesh();
-        auto max_level = mesh.max_level();
-        for (std::size_t level = 0; level <= max_level; ++level)
+        detail::GhostExchange<mesh_t> m_exchange;
+#endif
+    };
+
+    template <class... Fields>
+    GhostUpdateHandle<Fields...>::GhostUpdateHandle(Fields&... fields)
+        : m_fields(fields...)
+#ifdef SAMURAI_WITH_MPI
+        , m_exchange(std::get<0>(m_fields).mesh(),
+                     std::get<0>(m_fields).mesh().max_level(),
+                     std::get<0>(m_fields).mesh().max_level(),
+                     static_cast<int>(std::get<0>(m_fields).mesh().max_level()))
+#endif
+    {
+#ifdef SAMURAI_WITH_MPI
+        m_exchange.start(fields...);
+#endif
+    }
+
+    template <class... Fields>
+    GhostUpdateHandle<Fields...>::GhostUpdateHandle(GhostUpdateHandle&& other) noexcept
+        : m_fields(other.m_fields)
+        , m_pending(std::exchange(other.m_pending, false))
+#ifdef SAMURAI_WITH_MPI
+        , m_exchange(std::move(other.m_exchange))
+#endif
+    {
+    }
+
+    template <class... Fields>
+    GhostUpdateHandle<Fields...>::~GhostUpdateHandle()
+    {
+        wait();
+    }
+
+    template <class... Fields>
+    bool GhostUpdateHandle<Fields...>::is_pending() const
+    {
+        return m_pending;
+    }
+
+    template <class... Fields>
+    void GhostUpdateHandle<Fields...>::wait()
+    {
+        if (!m_pending)
+        {
+            return;
+        }
+        SAMURAI_PROFILE_REGION("ghost update");
+        std::apply(
+            [&](auto&... f)
+            {
+#ifdef SAMURAI_WITH_MPI
+                m_exchange.finish(f...);
+#endif
+                ((f.ghosts_updated() = true), ...);
+            },
+            m_fields);
+        m_pending = false;
+    }
+
+    /**
+     * Starts the update of the ghosts of the fields: all the steps of update_ghost_mr() are done, except the
+     * last exchange of the MPI ghosts at max_level, which is only posted.
+     * Computations which do not read the MPI ghosts (e.g. the fluxes between cells of the subdomain)
+     * can then be done while the messages are in flight, before calling end_update_ghosts().
+     */
+    template <class Field, class... Fields>
+        requires field_like<Field> && (field_like<Fields> && ...)
+    auto begin_update_ghosts(Field& field, Fields&... other_fields)
+    {
         {
-            update_ghost_subdomains(level, field);
+            SAMURAI_PROFILE_REGION("ghost update");
+            detail::update_ghost_mr_except_last_exchange(field, other_fields...);
         }
+        return GhostUpdateHandle<Field, Fields...>(field, other_fields...);
+    }
+
+    template <class... T>
+    auto begin_update_ghosts(Field_tuple<T...>& fields)
+    {
+        return std::apply(
+            [](T&... tupleArgs)
+            {
+                return begin_update_ghosts(tupleArgs...);
+            },
+            fields.elements());
+    }
+
+    template <class... Fields>
+    void end_update_ghosts(GhostUpdateHandle<Fields...>& handle)
+    {
+        handle.wait();
+    }
+
+    /**
+     * Updates the MPI ghosts of the fields at all the levels, with one message per neighbour
+     * for all the fields and all the levels.
+     */
+    template <class Field, class... Fields>
+        requires field_like<Field> && (field_like<Fields> && ...)
+    void update_ghost_subdomains([[maybe_unused]] Field& field, [[maybe_unused]] Fields&... other_fields)
+    {
+#ifdef SAMURAI_WITH_MPI
+        using mesh_t = typename Field::mesh_t;
+
+        // The tag differs from the ones of the exchanges at a single level
+        detail::GhostExchange exchange(field.mesh(), 0, field.mesh().max_level(), static_cast<int>(mesh_t::max_refinement_level) + 1);
+        exchange.start(field, other_fields...);
+        exchange.finish(field, other_fields...);
 #endif
     }
 
+    template <class... T>
+    void update_ghost_subdomains(Field_tuple<T...>& fields)
+    {
+        std::apply(
+            [](T&... tupleArgs)
+            {
+                update_ghost_subdomains(tupleArgs...);
+            },
+            fields.elements());
+    }
+
     template <class Field>
     void update_tag_subdomains([[maybe_unused]] std::size_t level, [[maybe_unused]] Field& tag, [[maybe_unused]] bool erase = false)
     {
@@ -1347,6 +1764,7 @@ namespace samurai
         template <class PredictionOp, class Mesh, class Field>
         void update_field(PredictionOp&& prediction_op, Mesh& new_mesh, Field& field)
         {
+            SAMURAI_PROFILE_REGION("field update");
             using mesh_id_t = typename Mesh::mesh_id_t;
 
             Field new_field("new_f", new_mesh);
@@ -1364,18 +1782,21 @@ namespace samurai
             for (std::size_t level = min_level; level <= max_level; ++level)
             {
                 auto set = intersection(mesh[mesh_id_t::reference][level], new_mesh[mesh_id_t::cells][level]);
-                set.apply_op(copy(new_field, field));
+                set.template apply_op<Run::Parallel>(copy(new_field, field));
             }
 
             for (std::size_t level = min_level + 1; level <= max_level; ++level)
             {
                 auto set_coarsen = intersection(mesh[mesh_id_t::cells][level], new_mesh[mesh_id_t::cells][level - 1]).on(level - 1);
-                set_coarsen.apply_op(projection(new_field, field));
+                set_coarsen.template apply_op<Run::Parallel>(projection(new_field, field));
 
                 auto set_refine = intersection(new_mesh[mesh_id_t::cells][level], mesh[mesh_id_t::cells][level - 1]).on(level - 1);
                 set_refine.apply_op(std::forward<PredictionOp>(prediction_op)(new_field, field));
             }
 
+            profiling::add_field_bytes(field, new_field);
+            // the old and the new values coexist until the swap: this is the peak of the field update
+            new_field.memory_handle().update("fields", field.name(), memory_usage(new_field));
             swap(field, new_field);
         }
     }
@@ -1443,7 +1864,10 @@ namespace samurai
         using mesh_t                     = typename Tag::mesh_t;
         using size_type                  = typename Tag::size_type;
         using mesh_id_t                  = typename Tag::mesh_t::mesh_id_t;
-        using cl_type                    = typename Tag::mesh_t::cl_type;
+        using ca_type                    = typename Tag::mesh_t::ca_type;
+        using cl_type                    = FlatCellList<dim, typename mesh_t::interval_t, mesh_t::max_refinement_level>;
+
+        SAMURAI_PROFILE_REGION("mesh adaptation");
 
         auto& mesh = tag.mesh();
 
@@ -1490,7 +1914,7 @@ namespace samurai
                               }
                           });
 
-        mesh_t new_mesh = {cl, mesh};
+        mesh_t new_mesh = {ca_type(cl, false), mesh};
 
 #ifdef SAMURAI_WITH_MPI
         mpi::communicator world;
@@ -1502,8 +1926,11 @@ namespace samurai
             return true;
         }
 
+        // the new mesh is recorded while the old one is alive, so that the peak of the adaptation is tracked
+        track_memory(new_mesh);
         update_fields(new_mesh, fields...);
         tag.mesh().swap(new_mesh);
+        track_memory(tag.mesh(), fields...);
         return false;
     }
 }
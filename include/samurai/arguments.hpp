@@ -2,6 +2,8 @@
 // SPDX-License-Identifier:  BSD-3-Clause
 #pragma once
 
+#include <string>
+
 #include <CLI/CLI.hpp>
 
 #include "samurai_config.hpp"
@@ -16,21 +18,38 @@ namespace samurai
         static std::size_t start_level      = std::numeric_limits<std::size_t>::max();
         static std::size_t graduation_width = std::numeric_limits<std::size_t>::max();
         static int max_stencil_radius       = std::numeric_limits<int>::max();
+        static std::string partitioning     = "";
+
+        static bool cache_stencil_indices = false;
 
-        static bool timers = false;
+        static bool timers            = false;
+        static std::string trace_file = "";
 #ifdef SAMURAI_WITH_MPI
         static bool dont_redirect_output = false;
 #endif
-        static int finer_level_flux       = 0;
-        static bool refine_boundary       = false;
-        static bool save_debug_fields     = false;
-        static bool print_petsc_numbering = false;
-        static int sleep_at_startup       = 0;
+        static int finer_level_flux        = 0;
+        static bool refine_boundary        = false;
+        static bool save_debug_fields      = false;
+        static bool compact_output         = false;
+        static bool single_precision       = false;
+        static bool output_index32         = false;
+        static int output_compression      = 0;
+        static bool shared_output_datasets = false;
+        static bool print_petsc_numbering  = false;
+        static int sleep_at_startup        = 0;
 
         // MRA arguments
         static double epsilon    = std::numeric_limits<double>::infinity();
         static double regularity = std::numeric_limits<double>::infinity();
         static bool rel_detail   = false;
+
+        // Load balancing arguments
+        static double lb_imbalance_threshold = std::numeric_limits<double>::infinity();
+        static std::size_t lb_frequency      = std::numeric_limits<std::size_t>::max();
+
+        // PETSc arguments
+        static bool petsc_matrix_free           = false;
+        static std::string petsc_matrix_free_pc = "none";
     }
 
     SAMURAI_INLINE void read_samurai_arguments(CLI::App& app, int& argc, char**& argv)
@@ -40,6 +59,14 @@ namespace samurai
         app.add_option("--start-level", args::start_level, "Start level of AMR")->group("SAMURAI");
         app.add_option("--graduation-width", args::graduation_width, "The graduation width of the mesh")->group("SAMURAI");
         app.add_option("--max-stencil-radius", args::max_stencil_radius, "The maximum number of neighbour in each direction")->group("SAMURAI");
+        app.add_option("--partitioning", args::partitioning, "The method used to distribute the cells between the MPI subdomains")
+            ->check(CLI::IsMember({"intervals", "morton", "hilbert"}))
+            ->group("SAMURAI");
+        app.add_flag("--cache-stencil-indices",
+                     args::cache_stencil_indices,
+                     "Cache the cell indices of the stencils used by the schemes until the mesh changes")
+            ->capture_default_str()
+            ->group("SAMURAI");
 
 #ifdef SAMURAI_WITH_MPI
         app.add_flag("--dont-redirect-output", args::dont_redirect_output, "Redirect the output for all ranks different of 0")
@@ -47,6 +74,10 @@ namespace samurai
             ->group("IO");
 #endif
         app.add_flag("--timers", args::timers, "Print timers at the end of the program")->capture_default_str()->group("Tools");
+        app.add_option("--trace-file",
+                       args::trace_file,
+                       "Save the profiling regions in the given file, in the Chrome trace format (chrome://tracing, Perfetto)")
+            ->group("Tools");
         app.add_option("--sleep-at-startup",
                        args::sleep_at_startup,
                        "Sleep for a given number of seconds at startup (useful to attach a debugger when running with mpirun/mpiexec)")
@@ -62,13 +93,54 @@ namespace samurai
         app.add_flag("--print-petsc-numbering", args::print_petsc_numbering, "Print the local and global numbering used for PETSc")
             ->capture_default_str()
             ->group("SAMURAI");
+        app.add_flag("--petsc-matrix-free",
+                     args::petsc_matrix_free,
+                     "Apply the operators of the implicit schemes to the vectors instead of assembling their matrices")
+            ->capture_default_str()
+            ->group("SAMURAI");
+        app.add_option("--petsc-matrix-free-pc",
+                       args::petsc_matrix_free_pc,
+                       "Preconditioning matrix in matrix-free mode: none, or the assembled matrix (rebuilt once per solve)")
+            ->capture_default_str()
+            ->check(CLI::IsMember({"none", "assembled"}))
+            ->group("SAMURAI");
         app.add_flag("--save-debug-fields", args::save_debug_fields, "Add debug fields during save process (coordinates, indices, levels, ...)")
             ->capture_default_str()
             ->group("SAMURAI");
+        app.add_flag("--compact-output",
+                     args::compact_output,
+                     "Save the mesh as its intervals instead of explicit cells (expand it with python/expand_compact_output.py to visualize it)")
+            ->capture_default_str()
+            ->group("IO");
+        app.add_flag("--single-precision-output", args::single_precision, "Save the fields and the coordinates in single precision")
+            ->capture_default_str()
+            ->group("IO");
+        app.add_flag("--output-index32",
+                     args::output_index32,
+                     "Save the connectivity with 32-bit indices when the number of points allows it")
+            ->capture_default_str()
+            ->group("IO");
+        app.add_option("--output-compression",
+                       args::output_compression,
+                       "Deflate level (1-9) of the chunked output datasets, 0 to disable the compression")
+            ->capture_default_str()
+            ->check(CLI::Range(0, 9))
+            ->group("IO");
+        app.add_flag("--shared-output-datasets",
+                     args::shared_output_datasets,
+                     "In parallel, write one global dataset per array instead of one dataset per rank")
+            ->capture_default_str()
+            ->group("IO");
         app.add_option("--mr-eps", args::epsilon, "The epsilon used by the multiresolution to adapt the mesh")->group("Multiresolution");
         app.add_option("--mr-reg", args::regularity, "The regularity criteria used by the multiresolution to adapt the mesh")
             ->group("Multiresolution");
         app.add_flag("--mr-rel-detail", args::rel_detail, "Use relative detail instead of absolute detail")->group("Multiresolution");
+        app.add_option("--lb-threshold",
+                       args::lb_imbalance_threshold,
+                       "The relative load imbalance (max_load / mean_load - 1) above which the cells are migrated between the MPI ranks")
+            ->group("Load balancing");
+        app.add_option("--lb-frequency", args::lb_frequency, "The number of calls to the load balancer between two load balancing steps")
+            ->group("Load balancing");
         app.allow_extras();
         app.set_help_flag("", ""); // deactivate --help option
         try
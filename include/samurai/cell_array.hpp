@@ -10,6 +10,7 @@
 
 #include "algorithm.hpp"
 #include "cell_list.hpp"
+#include "flat_cell_list.hpp"
 #include "level_cell_array.hpp"
 #include "samurai_config.hpp"
 #include "utils.hpp"
@@ -90,6 +91,7 @@ namespace samurai
 
         CellArray();
         CellArray(const cl_type& cl, bool with_update_index = true);
+        CellArray(const FlatCellList<dim, TInterval, max_size>& cl, bool with_update_index = true);
 
         const lca_type& operator[](std::size_t i) const;
         lca_type& operator[](std::size_t i);
@@ -273,6 +275,30 @@ namespace samurai
         }
     }
 
+    /**
+     * Construction of a CellArray from a FlatCellList
+     *
+     * @param cl The cell list.
+     * @param with_update_index A boolean indicating if the index of the
+     * x-intervals must be computed.
+     */
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE
+    CellArray<dim_, TInterval, max_size_>::CellArray(const FlatCellList<dim, TInterval, max_size>& cl, bool with_update_index)
+    {
+        for (std::size_t level = 0; level <= max_size; ++level)
+        {
+            m_cells[level] = cl[level];
+            m_cells[level].set_origin_point(cl.origin_point());
+            m_cells[level].set_scaling_factor(cl.scaling_factor());
+        }
+
+        if (with_update_index)
+        {
+            update_index();
+        }
+    }
+
     template <std::size_t dim_, class TInterval, std::size_t max_size_>
     SAMURAI_INLINE bool CellArray<dim_, TInterval, max_size_>::empty() const
     {
@@ -15,8 +15,9 @@
 #include "../algorithm.hpp"
 #include "../bc/bc.hpp"
 #include "../field_expression.hpp"
+#include "../memory_tracker.hpp"
+#include "../profiling.hpp"
 #include "../storage/containers.hpp"
-#include "../timers.hpp"
 #include "field_iterator.hpp"
 
 namespace samurai
@@ -38,6 +39,7 @@ namespace samurai
             std::string m_name;
             bc_container p_bc;
             bool m_ghosts_updated = false;
+            mutable MemoryHandle m_memory_handle;
 
             Derived& derived_cast() & noexcept;
             const Derived& derived_cast() const& noexcept;
@@ -76,6 +78,8 @@ namespace samurai
             bool& ghosts_updated();
             bool ghosts_updated() const;
 
+            MemoryHandle& memory_handle() const;
+
             auto& array();
             const auto& array() const;
 
@@ -200,7 +204,7 @@ namespace samurai
                 return this->derived_cast();
             }
 
-            times::timers.start("field expressions");
+            SAMURAI_PROFILE_REGION("field expressions");
 
             using inner_mesh_t  = typename Derived::inner_mesh_t;
             using data_access_t = typename Derived::data_access_type;
@@ -219,7 +223,6 @@ namespace samurai
             std::swap(p_bc, tmp);
             m_ghosts_updated = other.m_ghosts_updated;
 
-            times::timers.stop("field expressions");
             return this->derived_cast();
         }
 
@@ -227,14 +230,14 @@ namespace samurai
         template <class E>
         SAMURAI_INLINE Derived& FieldBase<Derived>::assign_expression(const field_expression<E>& e)
         {
-            times::timers.start("field expressions");
+            SAMURAI_PROFILE_REGION("field expressions");
             for_each_interval(this->derived_cast().mesh(),
                               [&](std::size_t level, const auto& i, const auto& index)
                               {
                                   noalias(this->derived_cast()(level, i, index)) = e.derived_cast()(level, i, index);
                               });
             m_ghosts_updated = false;
-            times::timers.stop("field expressions");
+            profiling::add_field_bytes(this->derived_cast());
             return this->derived_cast();
         }
 
@@ -258,6 +261,12 @@ namespace samurai
             return m_name;
         }
 
+        template <class Derived>
+        SAMURAI_INLINE MemoryHandle& FieldBase<Derived>::memory_handle() const
+        {
+            return m_memory_handle;
+        }
+
         template <class Derived>
         SAMURAI_INLINE bool& FieldBase<Derived>::ghosts_updated()
         {
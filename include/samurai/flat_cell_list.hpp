@@ -0,0 +1,474 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/color.h>
+
+#include <xtensor/containers/xfixed.hpp>
+#include <xtensor/views/xview.hpp>
+
+#include "cell.hpp"
+#include "samurai_config.hpp"
+
+namespace samurai
+{
+    namespace detail
+    {
+        /**
+         * Stable LSD radix sort of entries on a signed integral key, one byte per pass.
+         * The passes where all the entries have the same digit are skipped: in practice, only the low bytes
+         * of the coordinates are sorted.
+         */
+        template <class Entry, class Key>
+        void radix_sort(std::vector<Entry>& entries, std::vector<Entry>& buffer, Key&& key)
+        {
+            using key_t  = std::decay_t<decltype(key(entries.front()))>;
+            using ukey_t = std::make_unsigned_t<key_t>;
+
+            static_assert(std::is_integral_v<key_t> && std::is_signed_v<key_t>, "The key must be a signed integer.");
+
+            constexpr ukey_t sign_bit = ukey_t{1} << (8 * sizeof(key_t) - 1);
+
+            buffer.resize(entries.size());
+            for (std::size_t byte = 0; byte < sizeof(key_t); ++byte)
+            {
+                // flipping the sign bit orders the negative keys before the positive ones
+                auto digit = [&](const Entry& e)
+                {
+                    return static_cast<std::size_t>(((static_cast<ukey_t>(key(e)) ^ sign_bit) >> (8 * byte)) & 0xff);
+                };
+
+                std::array<std::size_t, 256> count{};
+                for (const auto& e : entries)
+                {
+                    ++count[digit(e)];
+                }
+                if (count[digit(entries.front())] == entries.size())
+                {
+                    continue;
+                }
+
+                std::size_t offset = 0;
+                for (auto& c : count)
+                {
+                    auto n = c;
+                    c      = offset;
+                    offset += n;
+                }
+                for (const auto& e : entries)
+                {
+                    buffer[count[digit(e)]++] = e;
+                }
+                std::swap(entries, buffer);
+            }
+        }
+    } // namespace detail
+
+    //////////////////////////////////
+    // FlatLevelCellList definition //
+    //////////////////////////////////
+
+    /** @class FlatLevelCellList
+     *  @brief Builder of a LevelCellArray from unordered cells and intervals.
+     *
+     * Same interface as LevelCellList, but the intervals are appended to a flat vector instead of being inserted
+     * in nested std::map of interval lists. They are sorted by a radix sort and merged when the LevelCellArray
+     * is built, in a single pass.
+     */
+    template <std::size_t Dim, class TInterval = default_config::interval_t>
+    class FlatLevelCellList
+    {
+      public:
+
+        static constexpr auto dim = Dim;
+        using interval_t          = TInterval;
+        using value_t             = typename interval_t::value_t;
+        using index_yz_t          = xt::xtensor_fixed<value_t, xt::xshape<dim - 1>>;
+        using coords_t            = xt::xtensor_fixed<double, xt::xshape<dim>>;
+
+        struct entry_t
+        {
+            std::array<value_t, dim - 1> yz;
+            value_t start;
+            value_t end;
+        };
+
+        /// Appends the intervals of one row, as the interval list returned by LevelCellList::operator[].
+        class row_t
+        {
+          public:
+
+            row_t(FlatLevelCellList& lcl, const index_yz_t& index)
+                : m_lcl(lcl)
+            {
+                std::copy(index.cbegin(), index.cend(), m_yz.begin());
+            }
+
+            void add_point(value_t point)
+            {
+                m_lcl.push(m_yz, point, point + 1);
+            }
+
+            void add_interval(const interval_t& interval)
+            {
+                m_lcl.push(m_yz, interval.start, interval.end);
+            }
+
+          private:
+
+            FlatLevelCellList& m_lcl; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+            std::array<value_t, dim - 1> m_yz;
+        };
+
+        FlatLevelCellList();
+        FlatLevelCellList(std::size_t level);
+        FlatLevelCellList(std::size_t level, const coords_t& origin_point, double scaling_factor);
+
+        row_t operator[](const index_yz_t& index);
+
+        std::size_t level() const;
+
+        bool empty() const;
+        std::size_t nb_entries() const;
+
+        void to_stream(std::ostream& os) const;
+
+        void add_cell(const Cell<dim, interval_t>& cell);
+        void reserve(std::size_t n);
+
+        template <class Func>
+        void for_each_merged_interval(Func&& func) const;
+
+        auto& origin_point() const;
+        double scaling_factor() const;
+
+        void clear();
+
+      private:
+
+        void push(const std::array<value_t, dim - 1>& yz, value_t start, value_t end);
+        void sort_and_merge() const;
+
+        // sorted and merged in place on the first traversal
+        mutable std::vector<entry_t> m_entries;
+        mutable bool m_merged = true;
+        std::size_t m_level;
+        coords_t m_origin_point;
+        double m_scaling_factor = 1;
+    };
+
+    //////////////////////////////////////
+    // FlatLevelCellList implementation //
+    //////////////////////////////////////
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE FlatLevelCellList<Dim, TInterval>::FlatLevelCellList()
+        : m_level{0}
+    {
+        m_origin_point.fill(0);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE FlatLevelCellList<Dim, TInterval>::FlatLevelCellList(std::size_t level)
+        : m_level{level}
+    {
+        m_origin_point.fill(0);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE
+    FlatLevelCellList<Dim, TInterval>::FlatLevelCellList(std::size_t level, const coords_t& origin_point, double scaling_factor)
+        : m_level{level}
+        , m_origin_point(origin_point)
+        , m_scaling_factor(scaling_factor)
+    {
+    }
+
+    /// Inserter of the intervals at given dim-1 coordinates
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE auto FlatLevelCellList<Dim, TInterval>::operator[](const index_yz_t& index) -> row_t
+    {
+        return row_t(*this, index);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE std::size_t FlatLevelCellList<Dim, TInterval>::level() const
+    {
+        return m_level;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE bool FlatLevelCellList<Dim, TInterval>::empty() const
+    {
+        return m_entries.empty();
+    }
+
+    /// Number of stored intervals, before merging if it has not been done yet.
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE std::size_t FlatLevelCellList<Dim, TInterval>::nb_entries() const
+    {
+        return m_entries.size();
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE void FlatLevelCellList<Dim, TInterval>::to_stream(std::ostream& os) const
+    {
+        os << "FlatLevelCellList\n";
+        os << "=================\n";
+        for_each_merged_interval(
+            [&](const auto& interval, const auto& yz)
+            {
+                os << interval << " yz:";
+                for (const auto& y : yz)
+                {
+                    os << " " << y;
+                }
+                os << "\n";
+            });
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE void FlatLevelCellList<Dim, TInterval>::add_cell(const Cell<dim, interval_t>& cell)
+    {
+        using namespace xt::placeholders;
+
+        (*this)[xt::view(cell.indices, xt::range(1, _))].add_point(cell.indices[0]);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE void FlatLevelCellList<Dim, TInterval>::reserve(std::size_t n)
+    {
+        m_entries.reserve(n);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE void FlatLevelCellList<Dim, TInterval>::push(const std::array<value_t, dim - 1>& yz, value_t start, value_t end)
+    {
+        if (start >= end)
+        {
+            return;
+        }
+        // consecutive points of a row are extended in place, as they are often added in order
+        if (!m_entries.empty())
+        {
+            auto& last = m_entries.back();
+            if (last.yz == yz && last.start <= start && start <= last.end)
+            {
+                last.end = std::max(last.end, end);
+                return;
+            }
+        }
+        m_entries.push_back({yz, start, end});
+        m_merged = false;
+    }
+
+    /**
+     * Sorts the entries by (z, y, x) with a radix sort, then merges the overlapping and touching intervals of each row.
+     */
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE void FlatLevelCellList<Dim, TInterval>::sort_and_merge() const
+    {
+        if (m_merged)
+        {
+            return;
+        }
+
+        std::vector<entry_t> buffer;
+        detail::radix_sort(m_entries,
+                           buffer,
+                           [](const entry_t& e)
+                           {
+                               return e.start;
+                           });
+        for (std::size_t d = 0; d < dim - 1; ++d)
+        {
+            detail::radix_sort(m_entries,
+                               buffer,
+                               [d](const entry_t& e)
+                               {
+                                   return e.yz[d];
+                               });
+        }
+
+        std::size_t n = 0;
+        for (std::size_t i = 1; i < m_entries.size(); ++i)
+        {
+            auto& current = m_entries[n];
+            auto& e       = m_entries[i];
+            if (e.yz == current.yz && e.start <= current.end)
+            {
+                current.end = std::max(current.end, e.end);
+            }
+            else
+            {
+                m_entries[++n] = e;
+            }
+        }
+        m_entries.resize(n + 1);
+        m_merged = true;
+    }
+
+    /**
+     * Calls func(interval, yz) for each interval, in the order of the LevelCellArray, the intervals of each row being
+     * disjoint and not touching.
+     */
+    template <std::size_t Dim, class TInterval>
+    template <class Func>
+    SAMURAI_INLINE void FlatLevelCellList<Dim, TInterval>::for_each_merged_interval(Func&& func) const
+    {
+        if (m_entries.empty())
+        {
+            return;
+        }
+        sort_and_merge();
+
+        index_yz_t yz;
+        for (const auto& e : m_entries)
+        {
+            std::copy(e.yz.cbegin(), e.yz.cend(), yz.begin());
+            func(interval_t{e.start, e.end}, yz);
+        }
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE auto& FlatLevelCellList<Dim, TInterval>::origin_point() const
+    {
+        return m_origin_point;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE double FlatLevelCellList<Dim, TInterval>::scaling_factor() const
+    {
+        return m_scaling_factor;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE void FlatLevelCellList<Dim, TInterval>::clear()
+    {
+        m_entries.clear();
+        m_merged = true;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE std::ostream& operator<<(std::ostream& out, const FlatLevelCellList<Dim, TInterval>& level_cell_list)
+    {
+        level_cell_list.to_stream(out);
+        return out;
+    }
+
+    /////////////////////////////
+    // FlatCellList definition //
+    /////////////////////////////
+
+    /** @class FlatCellList
+     *  @brief Drop-in alternative to CellList, whose levels are FlatLevelCellList.
+     */
+    template <std::size_t dim_, class TInterval = default_config::interval_t, std::size_t max_size_ = default_config::max_level>
+    class FlatCellList
+    {
+      public:
+
+        static constexpr auto dim      = dim_;
+        static constexpr auto max_size = max_size_;
+
+        using lcl_type = FlatLevelCellList<dim, TInterval>;
+        using coords_t = typename lcl_type::coords_t;
+
+        FlatCellList();
+        FlatCellList(const coords_t& origin_point, double scaling_factor);
+
+        const lcl_type& operator[](std::size_t i) const;
+        lcl_type& operator[](std::size_t i);
+
+        void to_stream(std::ostream& os) const;
+
+        auto& origin_point() const;
+        auto scaling_factor() const;
+
+        void clear();
+
+      private:
+
+        std::array<lcl_type, max_size + 1> m_cells;
+    };
+
+    /////////////////////////////////
+    // FlatCellList implementation //
+    /////////////////////////////////
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE FlatCellList<dim_, TInterval, max_size_>::FlatCellList()
+    {
+        for (std::size_t level = 0; level <= max_size; ++level)
+        {
+            m_cells[level] = {level};
+        }
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE FlatCellList<dim_, TInterval, max_size_>::FlatCellList(const coords_t& origin_point, double scaling_factor)
+    {
+        for (std::size_t level = 0; level <= max_size; ++level)
+        {
+            m_cells[level] = {level, origin_point, scaling_factor};
+        }
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE auto FlatCellList<dim_, TInterval, max_size_>::operator[](std::size_t i) const -> const lcl_type&
+    {
+        return m_cells[i];
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE auto FlatCellList<dim_, TInterval, max_size_>::operator[](std::size_t i) -> lcl_type&
+    {
+        return m_cells[i];
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE void FlatCellList<dim_, TInterval, max_size_>::to_stream(std::ostream& os) const
+    {
+        for (std::size_t level = 0; level <= max_size; ++level)
+        {
+            os << fmt::format(fg(fmt::color::crimson) | fmt::emphasis::bold, "Level {}\n", level);
+            m_cells[level].to_stream(os);
+            os << "\n";
+        }
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE auto& FlatCellList<dim_, TInterval, max_size_>::origin_point() const
+    {
+        return m_cells[0].origin_point();
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE auto FlatCellList<dim_, TInterval, max_size_>::scaling_factor() const
+    {
+        return m_cells[0].scaling_factor();
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE void FlatCellList<dim_, TInterval, max_size_>::clear()
+    {
+        for (std::size_t level = 0; level <= max_size; ++level)
+        {
+            m_cells[level].clear();
+        }
+    }
+
+    template <std::size_t dim_, class TInterval, std::size_t max_size_>
+    SAMURAI_INLINE std::ostream& operator<<(std::ostream& out, const FlatCellList<dim_, TInterval, max_size_>& cell_list)
+    {
+        cell_list.to_stream(out);
+        return out;
+    }
+} // namespace samurai
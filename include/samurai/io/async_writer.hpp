@@ -0,0 +1,274 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include "../memory.hpp"
+#include "../profiling.hpp"
+#include "hdf5.hpp"
+#include "restart.hpp"
+
+namespace samurai
+{
+    /**
+     * Runs output tasks on a dedicated I/O thread, in the order in which they are pushed.
+     *
+     * At most max_pending tasks wait in the queue: push() blocks while it is full, which bounds the memory used by the
+     * snapshots. wait() blocks until all the pushed tasks are written, and rethrows the first exception raised by a task.
+     * The destructor waits for the pending tasks.
+     *
+     * With MPI, the HDF5 output is collective and interleaves MPI calls with the time loop,
+     * so the tasks are run synchronously by push().
+     *
+     * HDF5 is not assumed to be thread-safe: while tasks are pending, the other outputs must go through the writer too,
+     * or be preceded by a call to wait().
+     */
+    class AsyncWriter
+    {
+      public:
+
+        explicit AsyncWriter(std::size_t max_pending = 2);
+        ~AsyncWriter();
+
+        AsyncWriter(const AsyncWriter&)            = delete;
+        AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+        void push(std::function<void()> task);
+        void wait();
+
+        std::size_t max_pending() const;
+
+      private:
+
+        void run();
+        void rethrow_if_failed();
+
+        std::size_t m_max_pending;
+        std::deque<std::function<void()>> m_tasks;
+        bool m_busy = false;
+        bool m_stop = false;
+        std::exception_ptr m_error;
+
+        std::mutex m_mutex;
+        std::condition_variable m_task_pushed;
+        std::condition_variable m_task_done;
+        std::thread m_thread;
+    };
+
+    SAMURAI_INLINE AsyncWriter::AsyncWriter(std::size_t max_pending)
+        : m_max_pending(std::max(max_pending, std::size_t{1}))
+    {
+#ifndef SAMURAI_WITH_MPI
+        m_thread = std::thread(&AsyncWriter::run, this);
+#endif
+    }
+
+    SAMURAI_INLINE AsyncWriter::~AsyncWriter()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_task_pushed.notify_all();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    SAMURAI_INLINE std::size_t AsyncWriter::max_pending() const
+    {
+        return m_max_pending;
+    }
+
+    SAMURAI_INLINE void AsyncWriter::push(std::function<void()> task)
+    {
+        if (!m_thread.joinable())
+        {
+            task();
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_task_done.wait(lock,
+                             [&]()
+                             {
+                                 return m_tasks.size() < m_max_pending;
+                             });
+            m_tasks.push_back(std::move(task));
+        }
+        m_task_pushed.notify_one();
+        rethrow_if_failed();
+    }
+
+    SAMURAI_INLINE void AsyncWriter::wait()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_task_done.wait(lock,
+                             [&]()
+                             {
+                                 return m_tasks.empty() && !m_busy;
+                             });
+        }
+        rethrow_if_failed();
+    }
+
+    SAMURAI_INLINE void AsyncWriter::rethrow_if_failed()
+    {
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            std::swap(error, m_error);
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    SAMURAI_INLINE void AsyncWriter::run()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_task_pushed.wait(lock,
+                                   [&]()
+                                   {
+                                       return m_stop || !m_tasks.empty();
+                                   });
+                if (m_tasks.empty())
+                {
+                    return; // stopped, and all the tasks are written
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+                m_busy = true;
+            }
+
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (!m_error)
+                {
+                    m_error = std::current_exception();
+                }
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_busy = false;
+            }
+            m_task_done.notify_all();
+        }
+    }
+
+    namespace detail
+    {
+        template <class Field, class Mesh>
+        Field copy_field_on(const Field& field, Mesh& mesh)
+        {
+            Field copy(field.name(), mesh);
+            copy.array() = field.array();
+            return copy;
+        }
+
+        /**
+         * Deep copy of a mesh and of fields defined on it; the copied fields are attached to the copied mesh.
+         */
+        template <class Mesh, class... T>
+        struct Snapshot
+        {
+            explicit Snapshot(const Mesh& m, const T&... f)
+                : mesh(m)
+                , fields(copy_field_on(f, mesh)...)
+            {
+            }
+
+            Snapshot(const Snapshot&)            = delete;
+            Snapshot& operator=(const Snapshot&) = delete;
+
+            Mesh mesh;
+            std::tuple<T...> fields;
+            MemoryHandle memory; // released when the snapshot has been written
+        };
+
+        template <class Mesh, class... T>
+        auto make_snapshot(const Mesh& mesh, const T&... fields)
+        {
+            SAMURAI_PROFILE_REGION("data snapshot");
+            auto snapshot = std::make_shared<Snapshot<Mesh, T...>>(mesh, fields...);
+            snapshot->memory.update("I/O", "asynchronous snapshots", (memory_usage(snapshot->mesh) + ... + memory_usage(fields)));
+            return snapshot;
+        }
+    }
+
+    /**
+     * Same as save(), but the mesh and the fields are copied and written by the I/O thread of the writer.
+     */
+    template <class mesh_t, class... T>
+        requires(mesh_like<mesh_t>)
+    void async_save(AsyncWriter& writer,
+                    const fs::path& path,
+                    const std::string& filename,
+                    const Hdf5Options<mesh_t>& options,
+                    const mesh_t& mesh,
+                    const T&... fields)
+    {
+        auto snapshot = detail::make_snapshot(mesh, fields...);
+        writer.push(
+            [=]()
+            {
+                std::apply(
+                    [&](const auto&... f)
+                    {
+                        detail::save_impl(path, filename, options, snapshot->mesh, f...);
+                    },
+                    snapshot->fields);
+            });
+    }
+
+    template <class mesh_t, class... T>
+        requires(mesh_like<mesh_t>)
+    void async_save(AsyncWriter& writer, const fs::path& path, const std::string& filename, const mesh_t& mesh, const T&... fields)
+    {
+        async_save(writer, path, filename, Hdf5Options<mesh_t>{}, mesh, fields...);
+    }
+
+    /**
+     * Same as dump(), but the mesh and the fields are copied and written by the I/O thread of the writer.
+     */
+    template <class Mesh, class... T>
+    void async_dump(AsyncWriter& writer, const fs::path& path, const std::string& filename, const Mesh& mesh, const T&... fields)
+    {
+        auto snapshot = detail::make_snapshot(mesh, fields...);
+        writer.push(
+            [=]()
+            {
+                std::apply(
+                    [&](const auto&... f)
+                    {
+                        dump(path, filename, snapshot->mesh, f...);
+                    },
+                    snapshot->fields);
+            });
+    }
+} // namespace samurai
@@ -5,8 +5,14 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -35,10 +41,12 @@ namespace mpi = boost::mpi;
 
 #include "../algorithm.hpp"
 #include "../arguments.hpp"
+#include "../cell_array.hpp"
 #include "../concepts.hpp"
 #include "../field.hpp"
 #include "../interval.hpp"
-#include "../timers.hpp"
+#include "../level_cell_array.hpp"
+#include "../profiling.hpp"
 #include "../utils.hpp"
 #include "util.hpp"
 
@@ -147,8 +155,37 @@ namespace samurai
         return std::make_pair(coords, connectivity);
     }
 
+    /**
+     * Storage options of the datasets.
+     *  - compact: the mesh is saved as the intervals and offsets of its LevelCellArrays instead of explicit points and
+     *    connectivity. No XDMF file is written: python/expand_compact_output.py rebuilds the explicit geometry and the
+     *    XDMF file when the output is visualized;
+     *  - single_precision: the fields of doubles and the coordinates of the points are saved as floats;
+     *  - index32: the connectivity is saved with 32-bit indices when the number of points allows it;
+     *  - compression: deflate level (1-9) of the datasets, which are then chunked by chunk_size rows; 0 disables it;
+     *  - shuffle: byte shuffle filter applied before the deflate filter, which helps the compression of floating point values;
+     *  - shared_datasets: with MPI, the ranks write their blocks of global datasets, described by a single XDMF grid,
+     *    instead of one dataset and one grid per rank. It does not apply to the compact geometry.
+     */
+    struct Hdf5StorageOptions
+    {
+        bool compact           = args::compact_output;
+        bool single_precision  = args::single_precision;
+        bool index32           = args::output_index32;
+        unsigned compression   = static_cast<unsigned>(args::output_compression);
+        bool shuffle           = true;
+        std::size_t chunk_size = 1 << 16;
+        bool shared_datasets   = args::shared_output_datasets;
+    };
+
+    /**
+     * Output options.
+     *  - by_level: one grid per level;
+     *  - by_mesh_id: one grid per mesh id (cells, ghosts, ...);
+     *  - the storage options of Hdf5StorageOptions.
+     */
     template <class D>
-    struct Hdf5Options
+    struct Hdf5Options : Hdf5StorageOptions
     {
         Hdf5Options(bool level = false, bool mesh_id = false)
             : by_level(level)
@@ -164,7 +201,7 @@ namespace samurai
     class UniformMesh;
 
     template <class Config>
-    struct Hdf5Options<UniformMesh<Config>>
+    struct Hdf5Options<UniformMesh<Config>> : Hdf5StorageOptions
     {
         Hdf5Options(bool mesh_id = false)
             : by_mesh_id(mesh_id)
@@ -174,6 +211,182 @@ namespace samurai
         bool by_mesh_id;
     };
 
+    namespace detail
+    {
+        template <std::size_t dim, class TInterval>
+        auto compact_output_levels(const LevelCellArray<dim, TInterval>& lca)
+        {
+            return std::make_pair(lca.level(), lca.level());
+        }
+
+        template <std::size_t dim, class TInterval, std::size_t max_size>
+        auto compact_output_levels(const CellArray<dim, TInterval, max_size>& ca)
+        {
+#ifdef SAMURAI_WITH_MPI
+            mpi::communicator world;
+            auto min_level = mpi::all_reduce(world, ca.min_level(), mpi::minimum<std::size_t>());
+            auto max_level = mpi::all_reduce(world, ca.max_level(), mpi::maximum<std::size_t>());
+#else
+            auto min_level = ca.min_level();
+            auto max_level = ca.max_level();
+#endif
+            return std::make_pair(min_level, max_level);
+        }
+
+        template <std::size_t dim, class TInterval>
+        const auto& compact_output_lca(const LevelCellArray<dim, TInterval>& lca, std::size_t)
+        {
+            return lca;
+        }
+
+        template <std::size_t dim, class TInterval, std::size_t max_size>
+        const auto& compact_output_lca(const CellArray<dim, TInterval, max_size>& ca, std::size_t level)
+        {
+            return ca[level];
+        }
+
+        SAMURAI_INLINE HighFive::File create_h5file(const fs::path& path, const std::string& filename)
+        {
+            HighFive::FileAccessProps fapl;
+#ifdef SAMURAI_WITH_MPI
+            fapl.add(HighFive::MPIOFileAccess{MPI_COMM_WORLD, MPI_INFO_NULL});
+            fapl.add(HighFive::MPIOCollectiveMetadata{});
+#endif
+            return HighFive::File(fmt::format("{}.h5", (path / filename).string()), HighFive::File::Overwrite, fapl);
+        }
+
+        /**
+         * Dataset creation properties: chunked, with the shuffle and deflate filters, when the compression is enabled.
+         */
+        SAMURAI_INLINE HighFive::DataSetCreateProps dataset_create_props(const Hdf5StorageOptions& storage, std::vector<std::size_t> dims)
+        {
+            HighFive::DataSetCreateProps props;
+            if (storage.compression > 0 && !dims.empty() && dims[0] != 0)
+            {
+                dims[0] = std::min(dims[0], std::max(storage.chunk_size, std::size_t{1}));
+                props.add(HighFive::Chunking(std::vector<hsize_t>(dims.begin(), dims.end())));
+                if (storage.shuffle)
+                {
+                    props.add(HighFive::Shuffle());
+                }
+                props.add(HighFive::Deflate(storage.compression));
+            }
+            return props;
+        }
+
+        /**
+         * Creates the dataset path of dimensions dims, whose values are stored as Narrow if narrow is true and as T otherwise,
+         * and writes the block of size count of data at offset (data may be null if the block is empty).
+         */
+        template <class Narrow, class T>
+        void write_dataset(HighFive::File& h5_file,
+                           const std::string& path,
+                           const std::vector<std::size_t>& dims,
+                           const std::vector<std::size_t>& offset,
+                           const std::vector<std::size_t>& count,
+                           const T* data,
+                           bool narrow,
+                           const Hdf5StorageOptions& storage,
+                           const HighFive::DataTransferProps& xfer_props)
+        {
+            auto props = dataset_create_props(storage, dims);
+            if (narrow && !std::is_same_v<Narrow, T>)
+            {
+                std::size_t size = 1;
+                for (auto c : count)
+                {
+                    size *= c;
+                }
+                std::vector<Narrow> narrow_data(size);
+                std::transform(data,
+                               data + size,
+                               narrow_data.begin(),
+                               [](const T& v)
+                               {
+                                   return static_cast<Narrow>(v);
+                               });
+
+                auto dataset = h5_file.createDataSet<Narrow>(path, HighFive::DataSpace(dims), props);
+                dataset.select(offset, count).write_raw(narrow_data.data(), HighFive::AtomicType<Narrow>{}, xfer_props);
+            }
+            else
+            {
+                auto dataset = h5_file.createDataSet<T>(path, HighFive::DataSpace(dims), props);
+                dataset.select(offset, count).write_raw(data, HighFive::AtomicType<T>{}, xfer_props);
+            }
+        }
+
+        /**
+         * Sets the NumberType and Precision of an XDMF DataItem from the type of its values.
+         */
+        template <class T>
+        void set_number_type(pugi::xml_node& dataitem)
+        {
+            dataitem.append_attribute("NumberType") = std::is_floating_point_v<T> ? "Float" : (std::is_signed_v<T> ? "Int" : "UInt");
+            dataitem.append_attribute("Precision")  = sizeof(T);
+        }
+
+        template <class Narrow, class T>
+        void set_number_type(pugi::xml_node& dataitem, bool narrow)
+        {
+            if (narrow)
+            {
+                set_number_type<Narrow>(dataitem);
+            }
+            else
+            {
+                set_number_type<T>(dataitem);
+            }
+        }
+
+        /**
+         * Writes the local data of each rank in its own dataset {prefix}/rank_{rank}/{name},
+         * or in {prefix}/{name} without MPI or with only one process. Empty datasets are not created.
+         * The values are stored as Narrow if narrow is true.
+         */
+        template <class T, class Narrow = T>
+        void write_by_rank(HighFive::File& h5_file,
+                           const std::string& prefix,
+                           const std::string& name,
+                           const std::vector<T>& local_data,
+                           const Hdf5StorageOptions& storage = {},
+                           bool narrow = false)
+        {
+            auto xfer_props = HighFive::DataTransferProps{};
+#ifdef SAMURAI_WITH_MPI
+            mpi::communicator world;
+
+            auto rank = static_cast<std::size_t>(world.rank());
+            auto size = static_cast<std::size_t>(world.size());
+            xfer_props.add(HighFive::UseCollectiveIO{});
+
+            std::vector<std::size_t> sizes(size);
+            mpi::all_gather(world, local_data.size(), sizes.data());
+#else
+            std::size_t rank               = 0;
+            std::size_t size               = 1;
+            std::vector<std::size_t> sizes = {local_data.size()};
+#endif
+
+            for (std::size_t r = 0; r < size; ++r)
+            {
+                if (sizes[r] != 0)
+                {
+                    std::string path = (size == 1) ? fmt::format("{}/{}", prefix, name) : fmt::format("{}/rank_{}/{}", prefix, r, name);
+
+                    std::vector<std::size_t> data_size(1, 0);
+                    const T* data_ptr = nullptr;
+                    if (rank == r)
+                    {
+                        data_size[0] = sizes[r];
+                        data_ptr     = local_data.data();
+                    }
+                    write_dataset<Narrow>(h5_file, path, {sizes[r]}, {0}, data_size, data_ptr, narrow, storage, xfer_props);
+                }
+            }
+        }
+    }
+
     template <class D>
     class Hdf5
     {
@@ -181,7 +394,7 @@ namespace samurai
 
         using derived_type_save = D;
 
-        Hdf5(const fs::path& path, const std::string& filename);
+        Hdf5(const fs::path& path, const std::string& filename, const Hdf5StorageOptions& storage = {});
 
         ~Hdf5();
 
@@ -207,11 +420,13 @@ namespace samurai
 
       private:
 
-        static HighFive::File create_h5file(const fs::path& path, const std::string& filename);
+        template <class Submesh>
+        void save_compact_geometry(pugi::xml_node& grid_parent, const std::string& prefix, const Submesh& submesh);
 
         HighFive::File h5_file;
         fs::path m_path;
         std::string m_filename;
+        Hdf5StorageOptions m_storage;
         pugi::xml_document m_doc;
         pugi::xml_node m_domain;
     };
@@ -269,7 +484,7 @@ namespace samurai
                                                      const options_t& options,
                                                      const Mesh& mesh,
                                                      const T&... fields)
-        : hdf5_t(path, filename)
+        : hdf5_t(path, filename, options)
         , m_mesh(mesh)
         , m_options(options)
         , m_fields(fields...)
@@ -484,29 +699,23 @@ namespace samurai
     }
 
     template <class D>
-    SAMURAI_INLINE Hdf5<D>::Hdf5(const fs::path& path, const std::string& filename)
-        : h5_file(create_h5file(path, filename))
+    SAMURAI_INLINE Hdf5<D>::Hdf5(const fs::path& path, const std::string& filename, const Hdf5StorageOptions& storage)
+        : h5_file(detail::create_h5file(path, filename))
         , m_path(path)
         , m_filename(filename)
+        , m_storage(storage)
     {
         auto xdmf = m_doc.append_child("Xdmf");
         m_domain  = xdmf.append_child("Domain");
     }
 
-    template <class D>
-    HighFive::File Hdf5<D>::create_h5file(const fs::path& path, const std::string& filename)
-    {
-        HighFive::FileAccessProps fapl;
-#ifdef SAMURAI_WITH_MPI
-        fapl.add(HighFive::MPIOFileAccess{MPI_COMM_WORLD, MPI_INFO_NULL});
-        fapl.add(HighFive::MPIOCollectiveMetadata{});
-#endif
-        return HighFive::File(fmt::format("{}.h5", (path / filename).string()), HighFive::File::Overwrite, fapl);
-    }
-
     template <class D>
     SAMURAI_INLINE Hdf5<D>::~Hdf5()
     {
+        if (m_storage.compact)
+        {
+            return;
+        }
 #ifdef SAMURAI_WITH_MPI
         mpi::communicator world;
 
@@ -530,6 +739,12 @@ namespace samurai
     {
         static constexpr std::size_t dim = derived_type_save::dim;
 
+        if (m_storage.compact)
+        {
+            save_compact_geometry(grid_parent, prefix, submesh);
+            return;
+        }
+
         xt::xtensor<std::size_t, 2> local_connectivity;
         xt::xtensor<double, 2> local_coords;
         std::tie(local_coords, local_connectivity) = extract_coords_and_connectivity(submesh);
@@ -569,20 +784,33 @@ namespace samurai
 #ifdef SAMURAI_WITH_MPI
             xfer_props.add(HighFive::UseCollectiveIO{});
 #endif
-            if (size == 1)
-            {
-                auto connectivity = h5_file.createDataSet<std::size_t>(
-                    prefix + "/connectivity",
-                    HighFive::DataSpace(std::vector<std::size_t>{connectivity_sizes[rank], 1 << dim}));
-                auto coords = h5_file.createDataSet<double>(prefix + "/points",
-                                                            HighFive::DataSpace(std::vector<std::size_t>{coords_sizes[rank], 3}));
+            // the indices of the connectivity never exceed the total number of points
+            bool narrow_connectivity = m_storage.index32 && coords_cumsum.back() <= std::numeric_limits<std::uint32_t>::max();
+            bool narrow_coords       = m_storage.single_precision;
+            bool shared              = (size == 1) || m_storage.shared_datasets;
 
-                auto connectivity_slice = connectivity.select({connectivity_cumsum[rank], 0}, {connectivity_sizes[rank], 1 << dim});
+            if (shared)
+            {
+                // each rank writes its block of the global datasets, its point indices are shifted accordingly
                 local_connectivity += coords_cumsum[rank];
-                connectivity_slice.write_raw(local_connectivity.data(), HighFive::AtomicType<std::size_t>{}, xfer_props);
-
-                auto coords_slice = coords.select({0, 0}, {coords_sizes[rank], 3});
-                coords_slice.write_raw(local_coords.data(), HighFive::AtomicType<double>{}, xfer_props);
+                detail::write_dataset<std::uint32_t>(h5_file,
+                                                     prefix + "/connectivity",
+                                                     {connectivity_cumsum.back(), 1 << dim},
+                                                     {connectivity_cumsum[rank], 0},
+                                                     {connectivity_sizes[rank], 1 << dim},
+                                                     local_connectivity.data(),
+                                                     narrow_connectivity,
+                                                     m_storage,
+                                                     xfer_props);
+                detail::write_dataset<float>(h5_file,
+                                             prefix + "/points",
+                                             {coords_cumsum.back(), 3},
+                                             {coords_cumsum[rank], 0},
+                                             {coords_sizes[rank], 3},
+                                             local_coords.data(),
+                                             narrow_coords,
+                                             m_storage,
+                                             xfer_props);
             }
             else
             {
@@ -590,21 +818,21 @@ namespace samurai
                 {
                     if (coords_sizes[r] != 0)
                     {
-                        auto connectivity = h5_file.createDataSet<std::size_t>(
-                            prefix + fmt::format("/rank_{}/connectivity", r),
-                            HighFive::DataSpace(std::vector<std::size_t>{connectivity_sizes[r], 1 << dim}));
                         std::vector<std::size_t> conn_size(2, 0);
                         if (rank == r && connectivity_sizes[r] != 0)
                         {
                             conn_size = {connectivity_sizes[r], 1 << dim};
                         }
                         std::size_t* conn_ptr = (rank == r && connectivity_sizes[r] != 0) ? local_connectivity.data() : nullptr;
-
-                        auto connectivity_slice = connectivity.select({0, 0}, conn_size);
-                        connectivity_slice.write_raw(conn_ptr, HighFive::AtomicType<std::size_t>{}, xfer_props);
-
-                        auto coords = h5_file.createDataSet<double>(prefix + fmt::format("/rank_{}/points", r),
-                                                                    HighFive::DataSpace(std::vector<std::size_t>{coords_sizes[r], 3}));
+                        detail::write_dataset<std::uint32_t>(h5_file,
+                                                             prefix + fmt::format("/rank_{}/connectivity", r),
+                                                             {connectivity_sizes[r], 1 << dim},
+                                                             {0, 0},
+                                                             conn_size,
+                                                             conn_ptr,
+                                                             narrow_connectivity,
+                                                             m_storage,
+                                                             xfer_props);
 
                         std::vector<std::size_t> coord_size(2, 0);
                         double* coord_ptr = nullptr;
@@ -613,8 +841,15 @@ namespace samurai
                             coord_size = {coords_sizes[r], 3};
                             coord_ptr  = local_coords.data();
                         }
-                        auto coords_slice = coords.select({0, 0}, coord_size);
-                        coords_slice.write_raw(coord_ptr, HighFive::AtomicType<double>{}, xfer_props);
+                        detail::write_dataset<float>(h5_file,
+                                                     prefix + fmt::format("/rank_{}/points", r),
+                                                     {coords_sizes[r], 3},
+                                                     {0, 0},
+                                                     coord_size,
+                                                     coord_ptr,
+                                                     narrow_coords,
+                                                     m_storage,
+                                                     xfer_props);
                     }
                 }
             }
@@ -622,26 +857,28 @@ namespace samurai
             auto grid = grid_parent.append_child("Grid");
             if (rank == 0)
             {
-                if (size == 1)
+                if (shared)
                 {
                     grid.append_attribute("Name") = mesh_name.data();
 
                     auto topo                                 = grid.append_child("Topology");
                     topo.append_attribute("TopologyType")     = element_type(derived_type_save::dim).c_str();
-                    topo.append_attribute("NumberOfElements") = connectivity_sizes[rank];
+                    topo.append_attribute("NumberOfElements") = connectivity_cumsum.back();
 
                     auto topo_data                           = topo.append_child("DataItem");
-                    topo_data.append_attribute("Dimensions") = connectivity_sizes[rank] * (1 << dim);
+                    topo_data.append_attribute("Dimensions") = connectivity_cumsum.back() * (1 << dim);
                     topo_data.append_attribute("Format")     = "HDF";
-                    topo_data.text()                         = fmt::format("{}.h5:{}/connectivity", m_filename, prefix).data();
+                    detail::set_number_type<std::uint32_t, std::size_t>(topo_data, narrow_connectivity);
+                    topo_data.text() = fmt::format("{}.h5:{}/connectivity", m_filename, prefix).data();
 
                     auto geom                             = grid.append_child("Geometry");
                     geom.append_attribute("GeometryType") = "XYZ";
 
                     auto geom_data                           = geom.append_child("DataItem");
-                    geom_data.append_attribute("Dimensions") = coords_sizes[rank] * 3;
+                    geom_data.append_attribute("Dimensions") = coords_cumsum.back() * 3;
                     geom_data.append_attribute("Format")     = "HDF";
-                    geom_data.text()                         = fmt::format("{}.h5:{}/points", m_filename, prefix).data();
+                    detail::set_number_type<float, double>(geom_data, narrow_coords);
+                    geom_data.text() = fmt::format("{}.h5:{}/points", m_filename, prefix).data();
                 }
                 else
                 {
@@ -662,6 +899,7 @@ namespace samurai
                             auto topo_data                           = topo.append_child("DataItem");
                             topo_data.append_attribute("Dimensions") = connectivity_sizes[irank] * (1 << dim);
                             topo_data.append_attribute("Format")     = "HDF";
+                            detail::set_number_type<std::uint32_t, std::size_t>(topo_data, narrow_connectivity);
                             topo_data.text() = fmt::format("{}.h5:{}/rank_{}/connectivity", m_filename, prefix, irank).data();
 
                             auto geom                             = subgrid.append_child("Geometry");
@@ -670,6 +908,7 @@ namespace samurai
                             auto geom_data                           = geom.append_child("DataItem");
                             geom_data.append_attribute("Dimensions") = coords_sizes[irank] * 3;
                             geom_data.append_attribute("Format")     = "HDF";
+                            detail::set_number_type<float, double>(geom_data, narrow_coords);
                             geom_data.text() = fmt::format("{}.h5:{}/rank_{}/points", m_filename, prefix, irank).data();
                         }
                     }
@@ -680,6 +919,64 @@ namespace samurai
         }
     }
 
+    /**
+     * Saves the intervals of each level in {prefix}/cells/level/{level}/dim/{d}/intervals as (start, end) pairs,
+     * and the offsets of the dimensions d > 0 in {prefix}/cells/level/{level}/dim/{d}/offsets, as in a LevelCellArray.
+     * The fields are saved in the order of for_each_cell, i.e. level by level, in the order of the intervals.
+     * In parallel, each rank writes its own datasets under {prefix}/rank_{rank}, as for the explicit geometry.
+     */
+    template <class D>
+    template <class Submesh>
+    SAMURAI_INLINE void Hdf5<D>::save_compact_geometry(pugi::xml_node& grid_parent, const std::string& prefix, const Submesh& submesh)
+    {
+        static constexpr std::size_t dim = derived_type_save::dim;
+        using value_t                    = typename Submesh::interval_t::value_t;
+
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+        auto nb_cells = mpi::all_reduce(world, submesh.nb_cells(), std::plus<std::size_t>());
+#else
+        auto nb_cells = submesh.nb_cells();
+#endif
+        if (nb_cells == 0)
+        {
+            return;
+        }
+
+        auto [min_level, max_level] = detail::compact_output_levels(submesh);
+
+        H5Easy::dump(h5_file, prefix + "/cells/dim", dim);
+        H5Easy::dump(h5_file, prefix + "/cells/min_level", min_level);
+        H5Easy::dump(h5_file, prefix + "/cells/max_level", max_level);
+        // HighFive v3 does not support xfixed_container so we have to dump from an xtensor_container first
+        H5Easy::dump(h5_file, prefix + "/cells/origin_point", xt::xtensor<double, 1>{submesh.origin_point()});
+        H5Easy::dump(h5_file, prefix + "/cells/scaling_factor", submesh.scaling_factor());
+
+        for (std::size_t level = min_level; level <= max_level; ++level)
+        {
+            const auto& lca = detail::compact_output_lca(submesh, level);
+
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                std::vector<value_t> intervals;
+                intervals.reserve(2 * lca[d].size());
+                for (const auto& interval : lca[d])
+                {
+                    intervals.push_back(interval.start);
+                    intervals.push_back(interval.end);
+                }
+                detail::write_by_rank(h5_file, prefix, fmt::format("cells/level/{}/dim/{}/intervals", level, d), intervals, m_storage);
+            }
+            for (std::size_t d = 1; d < dim; ++d)
+            {
+                detail::write_by_rank(h5_file, prefix, fmt::format("cells/level/{}/dim/{}/offsets", level, d), lca.offsets(d), m_storage);
+            }
+        }
+
+        auto grid = grid_parent.append_child("Grid");
+        this->derived_cast().save_fields(grid, prefix, submesh);
+    }
+
     template <class D>
     template <class Submesh, class Field>
     SAMURAI_INLINE void Hdf5<D>::save_field(pugi::xml_node& grid, const std::string& prefix, const Submesh& submesh, const Field& field)
@@ -705,6 +1002,10 @@ namespace samurai
             field_cumsum[i + 1] += field_cumsum[i] + field_sizes[i];
         }
 
+        using value_t  = typename Field::value_type;
+        using narrow_t = std::conditional_t<std::is_same_v<value_t, double>, float, value_t>;
+        bool narrow    = m_storage.single_precision;
+
         for (std::size_t i = 0; i < field.n_comp; ++i)
         {
             std::string field_name;
@@ -717,19 +1018,21 @@ namespace samurai
                 field_name = fmt::format("{}_{}", field.name(), i);
             }
 
-            if (size == 1)
+            if (size == 1 || m_storage.shared_datasets)
             {
                 auto local_data  = extract_data(field, submesh);
                 std::string path = fmt::format("{}/fields/{}", prefix, field_name);
 
-                auto data = h5_file.createDataSet<typename Field::value_type>(
-                    path,
-                    HighFive::DataSpace(std::vector<std::size_t>{field_cumsum.back()}));
-
-                auto data_slice = data.select({field_cumsum[rank]}, {field_sizes[rank]});
-                data_slice.write_raw(xt::eval(xt::view(local_data, xt::all(), i)).data(),
-                                     HighFive::AtomicType<typename Field::value_type>{},
-                                     xfer_props);
+                auto column = xt::eval(xt::view(local_data, xt::all(), i));
+                detail::write_dataset<narrow_t>(h5_file,
+                                                path,
+                                                {field_cumsum.back()},
+                                                {field_cumsum[rank]},
+                                                {field_sizes[rank]},
+                                                column.data(),
+                                                narrow,
+                                                m_storage,
+                                                xfer_props);
 
                 auto attribute                       = grid.append_child("Attribute");
                 attribute.append_attribute("Name")   = field_name.data();
@@ -738,24 +1041,21 @@ namespace samurai
                 auto dataitem                           = attribute.append_child("DataItem");
                 dataitem.append_attribute("Dimensions") = field_cumsum.back();
                 dataitem.append_attribute("Format")     = "HDF";
-                dataitem.append_attribute("Precision")  = "8";
-                dataitem.text()                         = fmt::format("{}.h5:{}", m_filename, path).data();
+                detail::set_number_type<narrow_t, value_t>(dataitem, narrow);
+                dataitem.text() = fmt::format("{}.h5:{}", m_filename, path).data();
             }
             else
             {
                 auto local_data = extract_data(field, submesh);
-                xt::xtensor<typename Field::value_type, 1> data_tmp;
+                xt::xtensor<value_t, 1> data_tmp;
                 for (std::size_t irank = 0; irank < size; ++irank)
                 {
                     if (field_sizes[irank] != 0)
                     {
                         std::string path = fmt::format("{}/rank_{}/fields/{}", prefix, irank, field_name);
-                        auto data        = h5_file.createDataSet<typename Field::value_type>(
-                            path,
-                            HighFive::DataSpace(std::vector<std::size_t>{field_sizes[irank]}));
 
                         std::vector<std::size_t> data_size(1, 0);
-                        typename Field::value_type* data_ptr = nullptr;
+                        value_t* data_ptr = nullptr;
 
                         if (rank == irank)
                         {
@@ -763,8 +1063,15 @@ namespace samurai
                             data_ptr     = data_tmp.data();
                             data_size[0] = field_sizes[irank];
                         }
-                        auto data_slice = data.select({0}, data_size);
-                        data_slice.write_raw(data_ptr, HighFive::AtomicType<typename Field::value_type>{}, xfer_props);
+                        detail::write_dataset<narrow_t>(h5_file,
+                                                        path,
+                                                        {field_sizes[irank]},
+                                                        {0},
+                                                        data_size,
+                                                        data_ptr,
+                                                        narrow,
+                                                        m_storage,
+                                                        xfer_props);
                     }
                 }
                 if (rank == 0)
@@ -781,7 +1088,8 @@ namespace samurai
                         auto dataitem                           = attribute.append_child("DataItem");
                         dataitem.append_attribute("Dimensions") = field_sizes[irank];
                         dataitem.append_attribute("Format")     = "HDF";
-                        dataitem.text()                         = fmt::format("{}.h5:{}", m_filename, path).data();
+                        detail::set_number_type<narrow_t, value_t>(dataitem, narrow);
+                        dataitem.text() = fmt::format("{}.h5:{}", m_filename, path).data();
                     }
                 }
             }
@@ -998,46 +1306,58 @@ namespace samurai
         using hdf5_mesh_t = typename hdf5_mesh<D, T...>::type;
     }
 
-    template <class mesh_t, class... T>
-        requires(mesh_like<mesh_t>)
-    void save(const fs::path& path, const std::string& filename, const Hdf5Options<mesh_t>& options, const mesh_t& mesh, const T&... fields)
+    namespace detail
     {
-        static constexpr std::size_t dim = mesh_t::dim;
-        times::timers.start("data saving");
-
-        if (!fs::exists(path))
+        template <class mesh_t, class... T>
+        void save_impl(const fs::path& path,
+                       const std::string& filename,
+                       const Hdf5Options<mesh_t>& options,
+                       const mesh_t& mesh,
+                       const T&... fields)
         {
-            fs::create_directory(path);
-        }
+            static constexpr std::size_t dim = mesh_t::dim;
 
-        if (args::save_debug_fields)
-        {
-            const auto& mesh_ref = detail::get_all_cells(mesh);
+            if (!fs::exists(path))
+            {
+                fs::create_directory(path);
+            }
 
-            auto index_field = make_vector_field<int, dim>("indices", mesh);
-            auto coord_field = make_vector_field<double, dim>("coordinates", mesh);
-            auto level_field = make_scalar_field<std::size_t>("levels", mesh);
+            if (args::save_debug_fields)
+            {
+                const auto& mesh_ref = detail::get_all_cells(mesh);
 
-            using hdf5_t = detail::hdf5_mesh_t<mesh_t, decltype(index_field), decltype(coord_field), decltype(level_field), T...>;
+                auto index_field = make_vector_field<int, dim>("indices", mesh);
+                auto coord_field = make_vector_field<double, dim>("coordinates", mesh);
+                auto level_field = make_scalar_field<std::size_t>("levels", mesh);
 
-            for_each_cell(mesh_ref,
-                          [&](auto& cell)
-                          {
-                              index_field[cell] = cell.indices;
-                              coord_field[cell] = cell.center();
-                              level_field[cell] = cell.level;
-                          });
+                using hdf5_t = detail::hdf5_mesh_t<mesh_t, decltype(index_field), decltype(coord_field), decltype(level_field), T...>;
 
-            auto h5 = hdf5_t(path, filename, options, mesh, index_field, coord_field, level_field, fields...);
-            h5.save();
-        }
-        else
-        {
-            using hdf5_t = detail::hdf5_mesh_t<mesh_t, T...>;
-            auto h5      = hdf5_t(path, filename, options, mesh, fields...);
-            h5.save();
+                for_each_cell(mesh_ref,
+                              [&](auto& cell)
+                              {
+                                  index_field[cell] = cell.indices;
+                                  coord_field[cell] = cell.center();
+                                  level_field[cell] = cell.level;
+                              });
+
+                auto h5 = hdf5_t(path, filename, options, mesh, index_field, coord_field, level_field, fields...);
+                h5.save();
+            }
+            else
+            {
+                using hdf5_t = detail::hdf5_mesh_t<mesh_t, T...>;
+                auto h5      = hdf5_t(path, filename, options, mesh, fields...);
+                h5.save();
+            }
         }
-        times::timers.stop("data saving");
+    }
+
+    template <class mesh_t, class... T>
+        requires(mesh_like<mesh_t>)
+    void save(const fs::path& path, const std::string& filename, const Hdf5Options<mesh_t>& options, const mesh_t& mesh, const T&... fields)
+    {
+        SAMURAI_PROFILE_REGION("data saving");
+        detail::save_impl(path, filename, options, mesh, fields...);
     }
 
     template <class mesh_t, class... T>
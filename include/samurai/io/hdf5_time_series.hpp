@@ -0,0 +1,304 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "hdf5.hpp"
+
+namespace samurai
+{
+    /**
+     * Saves a sequence of solutions on a mesh in a single HDF5 file, described by one XDMF temporal collection.
+     *
+     * The geometry (points and connectivity) is written only when the cells of the mesh have changed (see Mesh_base::version())
+     * since the last written geometry: the following steps reference its Topology and Geometry elements through an XInclude/XPointer,
+     * so that only the fields are written at each step.
+     * The XDMF file is rewritten after each step, so that it remains readable if the simulation stops.
+     * The storage options single_precision, index32 and compression apply as for Hdf5; the geometry is always explicit
+     * and written in one dataset per rank (compact and shared_datasets are ignored).
+     */
+    template <class Mesh>
+    class Hdf5TimeSeries
+    {
+      public:
+
+        using mesh_t                     = Mesh;
+        using mesh_id_t                  = typename mesh_t::mesh_id_t;
+        static constexpr std::size_t dim = mesh_t::dim;
+
+        Hdf5TimeSeries(const fs::path& path, const std::string& filename, const mesh_t& mesh, const Hdf5StorageOptions& storage = {});
+
+        Hdf5TimeSeries(const Hdf5TimeSeries&)            = delete;
+        Hdf5TimeSeries& operator=(const Hdf5TimeSeries&) = delete;
+
+        template <class... T>
+        void save(double time, const T&... fields);
+
+        std::size_t nb_steps() const;
+        std::size_t nb_geometries() const;
+
+      private:
+
+        void save_geometry();
+        void append_geometry(pugi::xml_node& grid, std::size_t rank) const;
+
+        template <class Field>
+        void save_field(pugi::xml_node& step_grid, const std::string& prefix, const Field& field);
+
+        const mesh_t& m_mesh; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+        fs::path m_path;
+        std::string m_filename;
+        Hdf5StorageOptions m_storage;
+        HighFive::File m_h5_file;
+
+        pugi::xml_document m_doc;
+        pugi::xml_node m_collection;
+
+        std::size_t m_saved_version = 0; // version of the mesh whose geometry has been written last
+        std::size_t m_nb_steps      = 0;
+        std::size_t m_nb_geometries = 0;
+        std::size_t m_geometry_step = 0; // step whose grid defines the current geometry
+        std::vector<std::size_t> m_nb_cells;
+        std::vector<std::size_t> m_nb_points;
+        bool m_narrow_connectivity = false; // connectivity of the current geometry saved with 32-bit indices
+    };
+
+    template <class Mesh>
+    SAMURAI_INLINE Hdf5TimeSeries<Mesh>::Hdf5TimeSeries(const fs::path& path,
+                                                         const std::string& filename,
+                                                         const mesh_t& mesh,
+                                                         const Hdf5StorageOptions& storage)
+        : m_mesh(mesh)
+        , m_path(path)
+        , m_filename(filename)
+        , m_storage(storage)
+        , m_h5_file(detail::create_h5file(path, filename))
+    {
+        auto xdmf                         = m_doc.append_child("Xdmf");
+        xdmf.append_attribute("Version")  = "2.0";
+        xdmf.append_attribute("xmlns:xi") = "http://www.w3.org/2001/XInclude";
+
+        auto domain                                     = xdmf.append_child("Domain");
+        m_collection                                    = domain.append_child("Grid");
+        m_collection.append_attribute("Name")           = "TimeSeries";
+        m_collection.append_attribute("GridType")       = "Collection";
+        m_collection.append_attribute("CollectionType") = "Temporal";
+    }
+
+    template <class Mesh>
+    SAMURAI_INLINE std::size_t Hdf5TimeSeries<Mesh>::nb_steps() const
+    {
+        return m_nb_steps;
+    }
+
+    template <class Mesh>
+    SAMURAI_INLINE std::size_t Hdf5TimeSeries<Mesh>::nb_geometries() const
+    {
+        return m_nb_geometries;
+    }
+
+    template <class Mesh>
+    SAMURAI_INLINE void Hdf5TimeSeries<Mesh>::save_geometry()
+    {
+        const auto& cells = m_mesh[mesh_id_t::cells];
+
+        xt::xtensor<std::size_t, 2> local_connectivity;
+        xt::xtensor<double, 2> local_coords;
+        std::tie(local_coords, local_connectivity) = extract_coords_and_connectivity(cells);
+
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+        m_nb_cells.resize(static_cast<std::size_t>(world.size()));
+        m_nb_points.resize(static_cast<std::size_t>(world.size()));
+        mpi::all_gather(world, cells.nb_cells(), m_nb_cells.data());
+        mpi::all_gather(world, local_coords.shape(0), m_nb_points.data());
+#else
+        m_nb_cells  = {cells.nb_cells()};
+        m_nb_points = {local_coords.shape(0)};
+#endif
+
+        // the indices of the connectivity are local to each rank
+        auto max_nb_points    = *std::max_element(m_nb_points.begin(), m_nb_points.end());
+        m_narrow_connectivity = m_storage.index32 && max_nb_points <= std::numeric_limits<std::uint32_t>::max();
+
+        std::string prefix = fmt::format("/geometry/{}", m_nb_geometries);
+        detail::write_by_rank<double, float>(m_h5_file,
+                                             prefix,
+                                             "points",
+                                             std::vector<double>(local_coords.begin(), local_coords.end()),
+                                             m_storage,
+                                             m_storage.single_precision);
+        detail::write_by_rank<std::size_t, std::uint32_t>(m_h5_file,
+                                                          prefix,
+                                                          "connectivity",
+                                                          std::vector<std::size_t>(local_connectivity.begin(), local_connectivity.end()),
+                                                          m_storage,
+                                                          m_narrow_connectivity);
+
+        m_saved_version = m_mesh.version();
+        m_geometry_step = m_nb_steps;
+        ++m_nb_geometries;
+    }
+
+    template <class Mesh>
+    SAMURAI_INLINE void Hdf5TimeSeries<Mesh>::append_geometry(pugi::xml_node& grid, std::size_t rank) const
+    {
+        std::string grid_name = (m_nb_cells.size() == 1) ? fmt::format("step_{}", m_geometry_step)
+                                                          : fmt::format("step_{}_rank_{}", m_geometry_step, rank);
+        if (m_geometry_step != m_nb_steps)
+        {
+            std::string xpointer = fmt::format("xpointer(//Grid[@Name='{}']/*[self::Topology or self::Geometry])", grid_name);
+
+            auto include                         = grid.append_child("xi:include");
+            include.append_attribute("xpointer") = xpointer.data();
+            return;
+        }
+
+        std::string prefix = (m_nb_cells.size() == 1) ? fmt::format("/geometry/{}", m_nb_geometries - 1)
+                                                       : fmt::format("/geometry/{}/rank_{}", m_nb_geometries - 1, rank);
+
+        auto topo                                 = grid.append_child("Topology");
+        topo.append_attribute("TopologyType")     = element_type(dim).c_str();
+        topo.append_attribute("NumberOfElements") = m_nb_cells[rank];
+
+        auto topo_data                           = topo.append_child("DataItem");
+        topo_data.append_attribute("Dimensions") = m_nb_cells[rank] * (1 << dim);
+        topo_data.append_attribute("Format")     = "HDF";
+        detail::set_number_type<std::uint32_t, std::size_t>(topo_data, m_narrow_connectivity);
+        topo_data.text() = fmt::format("{}.h5:{}/connectivity", m_filename, prefix).data();
+
+        auto geom                             = grid.append_child("Geometry");
+        geom.append_attribute("GeometryType") = "XYZ";
+
+        auto geom_data                           = geom.append_child("DataItem");
+        geom_data.append_attribute("Dimensions") = m_nb_points[rank] * 3;
+        geom_data.append_attribute("Format")     = "HDF";
+        detail::set_number_type<float, double>(geom_data, m_storage.single_precision);
+        geom_data.text() = fmt::format("{}.h5:{}/points", m_filename, prefix).data();
+    }
+
+    template <class Mesh>
+    template <class Field>
+    SAMURAI_INLINE void Hdf5TimeSeries<Mesh>::save_field(pugi::xml_node& step_grid, const std::string& prefix, const Field& field)
+    {
+        using value_t  = typename Field::value_type;
+        using narrow_t = std::conditional_t<std::is_same_v<value_t, double>, float, value_t>;
+
+        auto local_data = extract_data(field, m_mesh[mesh_id_t::cells]);
+
+        for (std::size_t i = 0; i < field.n_comp; ++i)
+        {
+            std::string field_name = (Field::n_comp == 1) ? field.name() : fmt::format("{}_{}", field.name(), i);
+
+            auto column = xt::eval(xt::view(local_data, xt::all(), i));
+            detail::write_by_rank<value_t, narrow_t>(m_h5_file,
+                                                     prefix,
+                                                     fmt::format("fields/{}", field_name),
+                                                     std::vector<value_t>(column.begin(), column.end()),
+                                                     m_storage,
+                                                     m_storage.single_precision);
+
+            auto add_attribute = [&](pugi::xml_node& grid, std::size_t rank)
+            {
+                std::string path = (m_nb_cells.size() == 1) ? fmt::format("{}/fields/{}", prefix, field_name)
+                                                             : fmt::format("{}/rank_{}/fields/{}", prefix, rank, field_name);
+
+                auto attribute                       = grid.append_child("Attribute");
+                attribute.append_attribute("Name")   = field_name.data();
+                attribute.append_attribute("Center") = "Cell";
+
+                auto dataitem                           = attribute.append_child("DataItem");
+                dataitem.append_attribute("Dimensions") = m_nb_cells[rank];
+                dataitem.append_attribute("Format")     = "HDF";
+                detail::set_number_type<narrow_t, value_t>(dataitem, m_storage.single_precision);
+                dataitem.text() = fmt::format("{}.h5:{}", m_filename, path).data();
+            };
+
+            if (m_nb_cells.size() == 1)
+            {
+                add_attribute(step_grid, 0);
+            }
+            else
+            {
+                // one subgrid per non-empty rank, in the order of the ranks (see save())
+                auto subgrid = step_grid.child("Grid");
+                for (std::size_t rank = 0; rank < m_nb_cells.size(); ++rank)
+                {
+                    if (m_nb_cells[rank] != 0)
+                    {
+                        add_attribute(subgrid, rank);
+                        subgrid = subgrid.next_sibling("Grid");
+                    }
+                }
+            }
+        }
+    }
+
+    template <class Mesh>
+    template <class... T>
+    SAMURAI_INLINE void Hdf5TimeSeries<Mesh>::save(double time, const T&... fields)
+    {
+        SAMURAI_PROFILE_REGION("data saving");
+
+        bool geometry_changed = (m_nb_geometries == 0) || m_mesh.version() != m_saved_version;
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+        geometry_changed = mpi::all_reduce(world, geometry_changed, std::logical_or<bool>());
+#endif
+        if (geometry_changed)
+        {
+            save_geometry();
+        }
+
+        auto step_grid                     = m_collection.append_child("Grid");
+        step_grid.append_attribute("Name") = fmt::format("step_{}", m_nb_steps).data();
+        if (m_nb_cells.size() == 1)
+        {
+            step_grid.append_child("Time").append_attribute("Value") = time;
+            append_geometry(step_grid, 0);
+        }
+        else
+        {
+            step_grid.append_attribute("GridType")                   = "Collection";
+            step_grid.append_attribute("CollectionType")             = "Spatial";
+            step_grid.append_child("Time").append_attribute("Value") = time;
+            for (std::size_t rank = 0; rank < m_nb_cells.size(); ++rank)
+            {
+                if (m_nb_cells[rank] != 0)
+                {
+                    auto subgrid                     = step_grid.append_child("Grid");
+                    subgrid.append_attribute("Name") = fmt::format("step_{}_rank_{}", m_nb_steps, rank).data();
+                    append_geometry(subgrid, rank);
+                }
+            }
+        }
+
+        std::string prefix = fmt::format("/step/{}", m_nb_steps);
+        (save_field(step_grid, prefix, fields), ...);
+
+        m_h5_file.flush();
+#ifdef SAMURAI_WITH_MPI
+        if (world.rank() == 0)
+#endif
+        {
+            m_doc.save_file(fmt::format("{}.xdmf", (m_path / m_filename).string()).data());
+        }
+        ++m_nb_steps;
+    }
+
+    template <class Mesh>
+    auto make_hdf5_time_series(const fs::path& path, const std::string& filename, const Mesh& mesh, const Hdf5StorageOptions& storage = {})
+    {
+        if (!fs::exists(path))
+        {
+            fs::create_directory(path);
+        }
+        return Hdf5TimeSeries<Mesh>(path, filename, mesh, storage);
+    }
+} // namespace samurai
@@ -18,6 +18,7 @@ namespace mpi = boost::mpi;
 #include "../cell_array.hpp"
 #include "../concepts.hpp"
 #include "../interval.hpp"
+#include "../profiling.hpp"
 #include "../level_cell_array.hpp"
 #include "../mesh.hpp"
 #include "../uniform_mesh.hpp"
@@ -187,6 +188,7 @@ namespace samurai
     template <class Mesh, class... Fields>
     void dump(const fs::path& path, const std::string& filename, const Mesh& mesh, const Fields&... fields)
     {
+        SAMURAI_PROFILE_REGION("data dump");
         HighFive::FileAccessProps fapl;
 #ifdef SAMURAI_WITH_MPI
         fapl.add(HighFive::MPIOFileAccess{MPI_COMM_WORLD, MPI_INFO_NULL});
@@ -424,6 +426,7 @@ namespace samurai
     template <class Mesh, class... Fields>
     void load(const fs::path& path, const std::string& filename, Mesh& mesh, Fields&... fields)
     {
+        SAMURAI_PROFILE_REGION("data loading");
         HighFive::FileAccessProps fapl;
 #ifdef SAMURAI_WITH_MPI
         fapl.add(HighFive::MPIOFileAccess{MPI_COMM_WORLD, MPI_INFO_NULL});
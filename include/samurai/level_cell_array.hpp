@@ -20,8 +20,10 @@
 #include "algorithm.hpp"
 #include "box.hpp"
 #include "interval.hpp"
+#include "flat_cell_list.hpp"
 #include "level_cell_list.hpp"
 #include "mesh_interval.hpp"
+#include "outer_row_index.hpp"
 #include "samurai_config.hpp"
 #include "subset/node.hpp"
 #include "utils.hpp"
@@ -93,6 +95,7 @@ namespace samurai
 
         LevelCellArray() = default;
         LevelCellArray(const LevelCellList<Dim, TInterval>& lcl);
+        LevelCellArray(const FlatLevelCellList<Dim, TInterval>& lcl);
 
         template <class Op, class StartEndOp, class... S>
         LevelCellArray(Subset<Op, StartEndOp, S...> set);
@@ -180,6 +183,8 @@ namespace samurai
         const std::vector<std::size_t>& offsets(std::size_t d) const;
         std::vector<std::size_t>& offsets(std::size_t d);
 
+        const detail::OuterRowIndex<value_t>* outer_row_index() const;
+
         std::size_t level() const;
 
         void clear();
@@ -217,6 +222,7 @@ namespace samurai
             ar & m_is_box;
             // ar & m_origin_point; // doesn't compile: xt::xtensor_fixed cannot be serialized
             ar & m_scaling_factor;
+            m_outer_row_index.reset();
         }
 #endif
         template <bool isIntervalListEmpty, bool isParentPointNew, size_t d>
@@ -242,6 +248,8 @@ namespace samurai
         bool m_is_box       = false;
         coords_t m_origin_point;
         double m_scaling_factor = 1;
+
+        detail::OuterRowIndex<value_t> m_outer_row_index; ///< Acceleration of find() along the outermost dimension
     };
 
     ////////////////////////////////////////
@@ -347,6 +355,20 @@ namespace samurai
         }
     }
 
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE LevelCellArray<Dim, TInterval>::LevelCellArray(const FlatLevelCellList<Dim, TInterval>& lcl)
+        : m_level(lcl.level())
+        , m_origin_point(lcl.origin_point())
+        , m_scaling_factor(lcl.scaling_factor())
+    {
+        // the intervals are given sorted and merged, so that they are appended in a single pass
+        lcl.for_each_merged_interval(
+            [this](const auto& interval, const auto& yz)
+            {
+                add_interval_back(interval, yz);
+            });
+    }
+
     template <std::size_t Dim, class TInterval>
     template <class Op, class StartEndOp, class... S>
     SAMURAI_INLINE LevelCellArray<Dim, TInterval>::LevelCellArray(Subset<Op, StartEndOp, S...> set)
@@ -416,6 +438,7 @@ namespace samurai
     SAMURAI_INLINE void
     LevelCellArray<Dim, TInterval>::add_interval_back(const interval_t& x_interval, const fixed_array<value_t, Dim - 1>& yz)
     {
+        m_outer_row_index.reset();
         if (m_cells[Dim - 1].empty())
         {
             add_interval_back_rec<true, true, Dim - 1>(x_interval, yz);
@@ -808,6 +831,7 @@ namespace samurai
             m_offsets[d].clear();
         }
         m_cells[dim - 1].clear();
+        m_outer_row_index.reset();
     }
 
     template <std::size_t Dim, class TInterval>
@@ -949,6 +973,10 @@ namespace samurai
     template <std::size_t Dim, class TInterval>
     SAMURAI_INLINE auto LevelCellArray<Dim, TInterval>::operator[](std::size_t d) -> std::vector<interval_t>&
     {
+        if (d == dim - 1)
+        {
+            m_outer_row_index.reset();
+        }
         return m_cells[d];
     }
 
@@ -966,6 +994,23 @@ namespace samurai
         return m_offsets[d - 1];
     }
 
+    /**
+     * Dense index of the rows of the outermost dimension used by find(), built on the first call.
+     * Returns nullptr in 1D, or if this dimension is too sparse.
+     */
+    template <std::size_t Dim, class TInterval>
+    SAMURAI_INLINE auto LevelCellArray<Dim, TInterval>::outer_row_index() const -> const detail::OuterRowIndex<value_t>*
+    {
+        if constexpr (dim == 1)
+        {
+            return nullptr;
+        }
+        else
+        {
+            return m_outer_row_index.get(*this);
+        }
+    }
+
     template <std::size_t Dim, class TInterval>
     template <typename TGrid, std::size_t N>
     SAMURAI_INLINE void LevelCellArray<Dim, TInterval>::init_from_level_cell_list(const TGrid& grid,
@@ -0,0 +1,464 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "algorithm.hpp"
+#include "algorithm/utils.hpp"
+#include "arguments.hpp"
+#include "field.hpp"
+#include "profiling.hpp"
+#include "subset/node.hpp"
+
+#ifdef SAMURAI_WITH_MPI
+#include <boost/mpi.hpp>
+namespace mpi = boost::mpi;
+#endif
+
+namespace samurai
+{
+    class load_balancing_config
+    {
+      public:
+
+        /**
+         * @brief set the relative load imbalance (max_load / mean_load - 1) above which the cells are migrated
+         */
+        auto& imbalance_threshold(double threshold)
+        {
+            m_imbalance_threshold = threshold;
+            return *this;
+        }
+
+        auto& imbalance_threshold() const
+        {
+            return m_imbalance_threshold;
+        }
+
+        /**
+         * @brief set the number of calls to the load balancer between two load balancing steps (0 disables the load balancing)
+         */
+        auto& frequency(std::size_t freq)
+        {
+            m_frequency = freq;
+            return *this;
+        }
+
+        auto& frequency() const
+        {
+            return m_frequency;
+        }
+
+        /**
+         * @brief set the number of iterations of the diffusion process used to compute the load fluxes
+         */
+        auto& diffusion_iterations(std::size_t n_iterations)
+        {
+            m_diffusion_iterations = n_iterations;
+            return *this;
+        }
+
+        auto& diffusion_iterations() const
+        {
+            return m_diffusion_iterations;
+        }
+
+        /**
+         * @brief set the computational cost of a cell as a function of its level, used by the space-filling curve partitioners
+         * (e.g. 2^level with local time stepping).
+         * By default, all the cells have the same cost whatever their level, since the schemes do the same work on each cell.
+         */
+        auto& level_weight(std::function<double(std::size_t)> weight)
+        {
+            m_level_weight = std::move(weight);
+            return *this;
+        }
+
+        auto& level_weight() const
+        {
+            return m_level_weight;
+        }
+
+        void parse_args()
+        {
+            if (args::lb_imbalance_threshold != std::numeric_limits<double>::infinity())
+            {
+                m_imbalance_threshold = args::lb_imbalance_threshold;
+            }
+            if (args::lb_frequency != std::numeric_limits<std::size_t>::max())
+            {
+                m_frequency = args::lb_frequency;
+            }
+        }
+
+      private:
+
+        double m_imbalance_threshold       = 0.1;
+        std::size_t m_frequency            = 1;
+        std::size_t m_diffusion_iterations = 10;
+
+        std::function<double(std::size_t)> m_level_weight = [](std::size_t)
+        {
+            return 1.;
+        };
+    };
+
+#ifdef SAMURAI_WITH_MPI
+    namespace detail
+    {
+        template <class Field, class CellArray>
+        void pack_field_values(mpi::packed_oarchive& oa, Field& field, const CellArray& cells)
+        {
+            std::vector<typename Field::value_type> values;
+            values.reserve(cells.nb_cells() * Field::n_comp);
+            for_each_interval(cells,
+                              [&](std::size_t level, const auto& i, const auto& index)
+                              {
+                                  std::copy(field(level, i, index).begin(), field(level, i, index).end(), std::back_inserter(values));
+                              });
+            oa << values;
+        }
+
+        template <class Mesh, class Field, class CellArray>
+        void migrate_field(Mesh& new_mesh,
+                           Field& field,
+                           const std::vector<CellArray>& cells_received,
+                           std::vector<std::unique_ptr<mpi::packed_iarchive>>& archives)
+        {
+            using mesh_id_t = typename Mesh::mesh_id_t;
+
+            Field new_field("new_f", new_mesh);
+#ifdef SAMURAI_CHECK_NAN
+            new_field.fill(std::nan(""));
+#else
+            new_field.fill(0);
+#endif
+
+            // The cells staying on this rank
+            auto& mesh = field.mesh();
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                auto set = intersection(mesh[mesh_id_t::cells][level], new_mesh[mesh_id_t::cells][level]);
+                set.apply_op(copy(new_field, field));
+            }
+
+            // The cells received from the neighbours (unpacked in the same order as in pack_field_values())
+            for (std::size_t i_neigh = 0; i_neigh < cells_received.size(); ++i_neigh)
+            {
+                std::vector<typename Field::value_type> values;
+                *archives[i_neigh] >> values;
+
+                auto it = values.cbegin();
+                for_each_interval(cells_received[i_neigh],
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      auto data = new_field(level, i, index);
+                                      std::copy(it, it + std::ssize(data), data.begin());
+                                      it += std::ssize(data);
+                                  });
+            }
+
+            swap(field, new_field);
+        }
+
+        /**
+         * Sends cells_to_send[r] to the rank r with the values of the fields, and rebuilds the mesh
+         * with the cells kept and the cells received. The MPI neighbourhood is recomputed.
+         * This function is collective.
+         */
+        template <class CellArray, class Field, class... Fields>
+        void migrate_cells(const std::vector<CellArray>& cells_to_send, Field& field, Fields&... fields)
+        {
+            using mesh_t    = typename Field::mesh_t;
+            using mesh_id_t = typename mesh_t::mesh_id_t;
+            using cl_type   = typename mesh_t::cl_type;
+
+            mpi::communicator world;
+            auto& mesh = field.mesh();
+
+            // Only the ranks exchanging cells communicate: the number of cells to receive is known beforehand.
+            std::vector<std::size_t> n_send(cells_to_send.size());
+            std::vector<std::size_t> n_recv;
+            for (std::size_t r = 0; r < cells_to_send.size(); ++r)
+            {
+                n_send[r] = cells_to_send[r].nb_cells();
+            }
+            mpi::all_to_all(world, n_send, n_recv);
+
+            std::vector<mpi::request> req;
+            std::vector<std::unique_ptr<mpi::packed_oarchive>> out_archives;
+            for (std::size_t r = 0; r < cells_to_send.size(); ++r)
+            {
+                if (n_send[r] > 0)
+                {
+                    auto& oa = out_archives.emplace_back(std::make_unique<mpi::packed_oarchive>(world));
+                    *oa << cells_to_send[r];
+                    pack_field_values(*oa, field, cells_to_send[r]);
+                    (pack_field_values(*oa, fields, cells_to_send[r]), ...);
+                    req.push_back(world.isend(static_cast<int>(r), static_cast<int>(r), *oa));
+                }
+            }
+
+            std::vector<CellArray> cells_received;
+            std::vector<std::unique_ptr<mpi::packed_iarchive>> in_archives;
+            for (std::size_t r = 0; r < n_recv.size(); ++r)
+            {
+                if (n_recv[r] > 0)
+                {
+                    auto& ia = in_archives.emplace_back(std::make_unique<mpi::packed_iarchive>(world));
+                    world.recv(static_cast<int>(r), world.rank(), *ia);
+                    *ia >> cells_received.emplace_back();
+                }
+            }
+            mpi::wait_all(req.begin(), req.end());
+
+            // New cells of this subdomain: the cells not sent plus the cells received
+            cl_type sent_cl;
+            for (const auto& cells : cells_to_send)
+            {
+                for_each_interval(cells,
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      sent_cl[level][index].add_interval(i);
+                                  });
+            }
+            CellArray sent_cells = {sent_cl, false};
+
+            cl_type cl;
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                auto kept_cells = difference(mesh[mesh_id_t::cells][level], sent_cells[level]);
+                kept_cells(
+                    [&](const auto& i, const auto& index)
+                    {
+                        cl[level][index].add_interval(i);
+                    });
+            }
+            for (const auto& cells : cells_received)
+            {
+                for_each_interval(cells,
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      cl[level][index].add_interval(i);
+                                  });
+            }
+
+            // The MPI neighbourhood is cleared so that it is recomputed from the new subdomains.
+            mesh.mpi_neighbourhood().clear();
+            mesh_t new_mesh = {cl, mesh};
+
+            migrate_field(new_mesh, field, cells_received, in_archives);
+            (migrate_field(new_mesh, fields, cells_received, in_archives), ...);
+
+            mesh.swap(new_mesh);
+        }
+
+        /**
+         * Relative imbalance (max_load / mean_load - 1) of the sum of the cell weights between the subdomains.
+         */
+        template <class Mesh, class Func>
+        double weighted_load_imbalance(const Mesh& mesh, Func&& weight)
+        {
+            mpi::communicator world;
+
+            double load = 0;
+            for_each_interval(mesh[Mesh::mesh_id_t::cells],
+                              [&](std::size_t level, const auto& interval, const auto& index)
+                              {
+                                  for (auto i = interval.start; i < interval.end; ++i)
+                                  {
+                                      load += weight(level, i, index);
+                                  }
+                              });
+            double max_load   = mpi::all_reduce(world, load, mpi::maximum<double>());
+            double total_load = mpi::all_reduce(world, load, std::plus<double>());
+
+            double mean_load = total_load / static_cast<double>(world.size());
+            return (mean_load > 0) ? max_load / mean_load - 1 : 0;
+        }
+    }
+#endif
+
+    namespace detail
+    {
+        template <class Func, class Field, class... Fields>
+        bool load_balance_impl([[maybe_unused]] const load_balancing_config& cfg,
+                               [[maybe_unused]] Func&& weight,
+                               [[maybe_unused]] Field& field,
+                               [[maybe_unused]] Fields&... fields)
+        {
+#ifdef SAMURAI_WITH_MPI
+            using mesh_t  = typename Field::mesh_t;
+            using ca_type = typename mesh_t::ca_type;
+
+            mpi::communicator world;
+            auto& mesh = field.mesh();
+
+            if (world.size() == 1)
+            {
+                return false;
+            }
+
+            bool use_sfc     = mesh.cfg().partitioning() != Partitioning::Intervals;
+            double imbalance = use_sfc ? weighted_load_imbalance(mesh, weight) : mesh.load_imbalance();
+            if (imbalance <= cfg.imbalance_threshold())
+            {
+                return false;
+            }
+
+            SAMURAI_PROFILE_REGION("load balancing");
+
+            std::vector<ca_type> cells_to_send;
+            if (use_sfc)
+            {
+                cells_to_send = mesh.sfc_partition(weight);
+            }
+            else
+            {
+                // The diffusion only moves cells towards the neighbouring subdomains
+                auto load_fluxes         = mesh.load_balancing(cfg.diffusion_iterations());
+                auto cells_to_neighbours = mesh.load_transfer(load_fluxes);
+                cells_to_send.resize(static_cast<std::size_t>(world.size()));
+                for (std::size_t i_neigh = 0; i_neigh < mesh.mpi_neighbourhood().size(); ++i_neigh)
+                {
+                    cells_to_send[static_cast<std::size_t>(mesh.mpi_neighbourhood()[i_neigh].rank)] = cells_to_neighbours[i_neigh];
+                }
+            }
+
+            migrate_cells(cells_to_send, field, fields...);
+
+            return true;
+#else
+            return false;
+#endif
+        }
+    }
+
+    /**
+     * Migrates cells and the values of the given fields between the MPI subdomains
+     * if the load imbalance is larger than the threshold given in the configuration.
+     * The subdomains, the MPI neighbourhood and the ghosts are then rebuilt.
+     *
+     * The cells to move are chosen according to the partitioning method of the mesh configuration:
+     *  - Intervals: diffusion of the number of cells between neighbouring subdomains;
+     *  - Morton, Hilbert: the leaf cells are redistributed along the space-filling curve,
+     *    each cell being weighted by cfg.level_weight() of its level.
+     *
+     * All the fields must be defined on the same mesh.
+     * This function is collective.
+     *
+     * @return true if cells have been migrated.
+     */
+    template <class Field, class... Fields>
+        requires field_like<Field> && (field_like<Fields> && ...)
+    bool load_balance(const load_balancing_config& cfg, Field& field, Fields&... fields)
+    {
+        return detail::load_balance_impl(
+            cfg,
+            [&](std::size_t level, auto, const auto&)
+            {
+                return cfg.level_weight()(level);
+            },
+            field,
+            fields...);
+    }
+
+    template <class... T, class... Fields>
+    bool load_balance(const load_balancing_config& cfg, Field_tuple<T...>& fields, Fields&... other_fields)
+    {
+        return std::apply(
+            [&](T&... tupleArgs)
+            {
+                return load_balance(cfg, tupleArgs..., other_fields...);
+            },
+            fields.elements());
+    }
+
+    /**
+     * Same as load_balance(), the weight of each cell being given by the scalar field `weight`
+     * (only used by the space-filling curve partitioners).
+     * If the weights must be kept, the weight field has to be passed in the list of fields to migrate.
+     */
+    template <class WeightField, class Field, class... Fields>
+        requires field_like<WeightField> && field_like<Field> && (field_like<Fields> && ...)
+    bool load_balance_with_weight(const load_balancing_config& cfg, const WeightField& weight, Field& field, Fields&... fields)
+    {
+        const auto& mesh = weight.mesh();
+        return detail::load_balance_impl(
+            cfg,
+            [&](std::size_t level, auto i, const auto& index)
+            {
+                return static_cast<double>(weight[mesh.get_index(level, i, index)]);
+            },
+            field,
+            fields...);
+    }
+
+    /**
+     * Load balancer to call periodically in the time loop:
+     * every `frequency` calls, the cells are migrated between the MPI ranks if the load imbalance
+     * exceeds the threshold (see load_balancing_config).
+     */
+    template <class TField, class... TFields>
+    class LoadBalancer
+    {
+      public:
+
+        explicit LoadBalancer(TField& field, TFields&... fields);
+
+        template <class... Fields>
+        bool operator()(load_balancing_config& cfg, Fields&... other_fields);
+
+        template <class... Fields>
+        bool operator()(Fields&... other_fields);
+
+      private:
+
+        std::tuple<TField&, TFields&...> m_fields;
+        std::size_t m_ncalls = 0;
+    };
+
+    template <class TField, class... TFields>
+    SAMURAI_INLINE LoadBalancer<TField, TFields...>::LoadBalancer(TField& field, TFields&... fields)
+        : m_fields(field, fields...)
+    {
+    }
+
+    template <class TField, class... TFields>
+    template <class... Fields>
+    bool LoadBalancer<TField, TFields...>::operator()(load_balancing_config& cfg, Fields&... other_fields)
+    {
+        cfg.parse_args();
+        if (cfg.frequency() == 0 || m_ncalls++ % cfg.frequency() != 0)
+        {
+            return false;
+        }
+        return std::apply(
+            [&](TField& field, TFields&... fields)
+            {
+                return load_balance(cfg, field, fields..., other_fields...);
+            },
+            m_fields);
+    }
+
+    template <class TField, class... TFields>
+    template <class... Fields>
+    bool LoadBalancer<TField, TFields...>::operator()(Fields&... other_fields)
+    {
+        load_balancing_config cfg;
+        return operator()(cfg, other_fields...);
+    }
+
+    template <class... TFields>
+        requires(field_like<TFields> && ...)
+    auto make_load_balancer(TFields&... fields)
+    {
+        return LoadBalancer<TFields...>(fields...);
+    }
+} // namespace samurai
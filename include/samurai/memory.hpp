@@ -4,10 +4,16 @@
 #pragma once
 
 #include <numeric>
+#include <tuple>
 
 #include <fmt/format.h>
 
+#include "cell_array.hpp"
+#include "concepts.hpp"
+#include "field.hpp"
 #include "level_cell_array.hpp"
+#include "memory_tracker.hpp"
+#include "mesh.hpp"
 
 namespace samurai
 {
@@ -53,4 +59,73 @@ namespace samurai
         }
         return mem;
     }
+
+    // Memory usage of the regions of a boundary condition, which are stored as level cell arrays
+    template <class Field>
+    std::size_t memory_usage(const Bc<Field>& bc)
+    {
+        const auto& region = bc.get_region();
+        std::size_t mem    = sizeof(bc) + region.first.size() * sizeof(region.first.front());
+        for (const auto& lca : region.second)
+        {
+            mem += memory_usage(lca);
+        }
+        return mem;
+    }
+
+    // Memory usage of the values of the field (ghosts included) and of its boundary conditions
+    template <class Field>
+        requires field_like<Field>
+    std::size_t memory_usage(const Field& field)
+    {
+        std::size_t mem = static_cast<std::size_t>(field.array().size()) * sizeof(typename Field::value_type);
+        for (const auto& bc : field.get_bc())
+        {
+            mem += memory_usage(*bc);
+        }
+        return mem;
+    }
+
+    /**
+     * Records in the memory tracker the memory of the fields, under their names.
+     * The entries are released when the fields are destroyed.
+     */
+    template <class... Fields>
+    void track_memory_of_fields(const Fields&... fields)
+    {
+        auto track_field = [](const auto& field)
+        {
+            using field_t = std::decay_t<decltype(field)>;
+            if constexpr (field_like<field_t>)
+            {
+                field.memory_handle().update("fields", field.name(), memory_usage(field));
+            }
+            else // Field_tuple
+            {
+                std::apply(
+                    [](const auto&... f)
+                    {
+                        track_memory_of_fields(f...);
+                    },
+                    field.elements());
+            }
+        };
+        (track_field(fields), ...);
+    }
+
+    /**
+     * Records in the memory tracker the memory of each mesh id of the mesh, and of the fields.
+     */
+    template <class Mesh, class... Fields>
+        requires mesh_like<Mesh>
+    void track_memory(const Mesh& mesh, const Fields&... fields)
+    {
+        using mesh_id_t = typename Mesh::mesh_id_t;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(mesh_id_t::count); ++i)
+        {
+            auto id = static_cast<mesh_id_t>(i);
+            mesh.memory_handle(id).update("mesh", fmt::format("{}", id), memory_usage(mesh[id]));
+        }
+        track_memory_of_fields(fields...);
+    }
 }
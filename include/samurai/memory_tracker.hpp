@@ -0,0 +1,324 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#ifdef SAMURAI_WITH_MPI
+#include <boost/mpi.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+#endif
+
+namespace samurai
+{
+    // Peak resident memory of the process in bytes, or 0 if it is not available on the platform
+    inline std::size_t peak_resident_memory()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#if defined(__APPLE__)
+        return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024; // in kilobytes on Linux
+#endif
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * Memory usage of the data structures of the run, by subsystem (meshes, fields, adaptation, PETSc, I/O).
+     *
+     * The sizes are recorded per object (see MemoryHandle), and released when the object is destroyed.
+     * Each entry sums the last sizes recorded by the living objects of a subsystem with the same name,
+     * and holds the peak of this sum over the run.
+     * The objects are recorded by the library after each change of the mesh (adaptation, load balancing),
+     * and can also be recorded by the user code, e.g. for the fields of the time loop:
+     *
+     *     samurai::track_memory(mesh, u, unp1);
+     */
+    class MemoryTracker
+    {
+      public:
+
+        struct Usage
+        {
+            std::size_t current = 0;
+            std::size_t peak    = 0;
+        };
+
+        struct Entry
+        {
+            std::string subsystem;
+            std::string name;
+            Usage usage;
+        };
+
+        /**
+         * Records the size of the object identified by owner, under the given subsystem and name (which may change between the calls).
+         */
+        void update(const void* owner, std::string_view subsystem, std::string_view name, std::size_t bytes)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto o = m_objects.find(owner);
+            if (o != m_objects.end())
+            {
+                remove(o->second);
+            }
+            else
+            {
+                o = m_objects.emplace(owner, Object{}).first;
+            }
+            o->second = {std::string(subsystem), std::string(name), bytes};
+
+            auto s = m_usages.find(subsystem);
+            if (s == m_usages.end())
+            {
+                s = m_usages.emplace(std::string(subsystem), std::map<std::string, Usage, std::less<>>{}).first;
+            }
+            auto u = s->second.find(name);
+            if (u == s->second.end())
+            {
+                u = s->second.emplace(std::string(name), Usage{}).first;
+            }
+
+            u->second.current += bytes;
+            u->second.peak = std::max(u->second.peak, u->second.current);
+            m_total.current += bytes;
+            m_total.peak = std::max(m_total.peak, m_total.current);
+        }
+
+        /**
+         * Removes the size of the object from the current usages (the peaks are kept).
+         */
+        void release(const void* owner)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto o = m_objects.find(owner);
+            if (o != m_objects.end())
+            {
+                remove(o->second);
+                m_objects.erase(o);
+            }
+        }
+
+        std::vector<Entry> entries() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::vector<Entry> result;
+            for (const auto& [subsystem, usages] : m_usages)
+            {
+                for (const auto& [name, usage] : usages)
+                {
+                    result.push_back({subsystem, name, usage});
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Sum of the current sizes of the entries, and its peak over the run.
+         */
+        Usage total() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_total;
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_objects.clear();
+            m_usages.clear();
+            m_total = {};
+        }
+
+        void print() const;
+
+      private:
+
+        struct Object
+        {
+            std::string subsystem;
+            std::string name;
+            std::size_t bytes = 0;
+        };
+
+        void remove(const Object& object)
+        {
+            auto& usage = m_usages.find(object.subsystem)->second.find(object.name)->second;
+            usage.current -= object.bytes;
+            m_total.current -= object.bytes;
+        }
+
+        mutable std::mutex m_mutex;
+        std::map<const void*, Object> m_objects;
+        std::map<std::string, std::map<std::string, Usage, std::less<>>, std::less<>> m_usages;
+        Usage m_total;
+    };
+
+    inline MemoryTracker& memory_tracker()
+    {
+        static MemoryTracker tracker;
+        return tracker;
+    }
+
+    /**
+     * Entry of the memory tracker owned by an object (field, mesh id, buffer), released when the object is destroyed.
+     * The copy of an object is another object: its memory is not tracked until it is recorded.
+     */
+    class MemoryHandle
+    {
+      public:
+
+        MemoryHandle() = default;
+
+        MemoryHandle(const MemoryHandle&) noexcept
+        {
+        }
+
+        MemoryHandle& operator=(const MemoryHandle&) noexcept
+        {
+            return *this;
+        }
+
+        ~MemoryHandle()
+        {
+            release();
+        }
+
+        void update(std::string_view subsystem, std::string_view name, std::size_t bytes)
+        {
+            memory_tracker().update(this, subsystem, name, bytes);
+            m_tracked = true;
+        }
+
+        void release()
+        {
+            if (m_tracked)
+            {
+                memory_tracker().release(this);
+                m_tracked = false;
+            }
+        }
+
+      private:
+
+        bool m_tracked = false;
+    };
+
+#ifdef SAMURAI_WITH_MPI
+    inline void MemoryTracker::print() const
+    {
+        boost::mpi::communicator world;
+
+        // The maximum over the ranks is printed, since it is the one which matters to size the nodes
+        std::vector<std::pair<std::string, std::pair<std::size_t, std::size_t>>> local;
+        for (const auto& e : entries())
+        {
+            local.emplace_back(e.subsystem + "/" + e.name, std::make_pair(e.usage.current, e.usage.peak));
+        }
+        std::vector<decltype(local)> all;
+        boost::mpi::gather(world, local, all, 0);
+
+        auto total   = this->total();
+        auto rss_max = boost::mpi::all_reduce(world, peak_resident_memory(), boost::mpi::maximum<std::size_t>());
+        auto peak    = boost::mpi::all_reduce(world, total.peak, boost::mpi::maximum<std::size_t>());
+
+        if (world.rank() != 0)
+        {
+            return;
+        }
+
+        std::map<std::string, std::tuple<std::size_t, std::size_t, int>> max_by_entry; // current, peak, rank of the peak
+        for (std::size_t rank = 0; rank < all.size(); ++rank)
+        {
+            for (const auto& [key, usage] : all[rank])
+            {
+                auto& m        = max_by_entry[key];
+                std::get<0>(m) = std::max(std::get<0>(m), usage.first);
+                if (usage.second >= std::get<1>(m))
+                {
+                    std::get<1>(m) = usage.second;
+                    std::get<2>(m) = static_cast<int>(rank);
+                }
+            }
+        }
+
+        std::size_t name_width = 24;
+        for (const auto& [key, m] : max_by_entry)
+        {
+            name_width = std::max(name_width, key.size() + 2);
+        }
+        const int nameWidth = static_cast<int>(name_width);
+
+        fmt::print("\n > [Master] Memory (max over the ranks)\n");
+        fmt::print(" {:<{}}{:>16}{:>16}{:>7}\n", "Name", nameWidth, "Current (MB)", "Peak (MB)", "[r]");
+        for (const auto& [key, m] : max_by_entry)
+        {
+            fmt::print(" {:<{}}{:>16.3f}{:>16.3f}{:>7}\n",
+                       key,
+                       nameWidth,
+                       1e-6 * static_cast<double>(std::get<0>(m)),
+                       1e-6 * static_cast<double>(std::get<1>(m)),
+                       fmt::format("[{}]", std::get<2>(m)));
+        }
+        fmt::print(" {:<{}}{:>16}{:>16.3f}\n", "peak of the total", nameWidth, "", 1e-6 * static_cast<double>(peak));
+        fmt::print(" {:<{}}{:>16}{:>16.3f}\n", "peak resident memory", nameWidth, "", 1e-6 * static_cast<double>(rss_max));
+    }
+#else
+    inline void MemoryTracker::print() const
+    {
+        auto entries = this->entries();
+        auto total   = this->total();
+
+        std::size_t name_width = 20;
+        for (const auto& e : entries)
+        {
+            name_width = std::max(name_width, e.subsystem.size() + e.name.size() + 3);
+        }
+        const int nameWidth = static_cast<int>(name_width);
+
+        fmt::print("{:<{}} {:>12} {:>12}\n", " ", nameWidth, "Current (MB)", "Peak (MB)");
+        for (const auto& e : entries)
+        {
+            fmt::print("{:<{}} {:>12.3f} {:>12.3f}\n",
+                       e.subsystem + "/" + e.name,
+                       nameWidth,
+                       1e-6 * static_cast<double>(e.usage.current),
+                       1e-6 * static_cast<double>(e.usage.peak));
+        }
+        fmt::print("{:-<{}}\n", "", nameWidth + 26);
+        fmt::print("{:<{}} {:>12.3f} {:>12.3f}\n",
+                   "total",
+                   nameWidth,
+                   1e-6 * static_cast<double>(total.current),
+                   1e-6 * static_cast<double>(total.peak));
+        fmt::print("{:<{}} {:>12} {:>12.3f}\n", "peak resident memory", nameWidth, "", 1e-6 * static_cast<double>(peak_resident_memory()));
+        fmt::print("\n");
+    }
+#endif
+}
@@ -4,6 +4,9 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
 #include <set>
 
 #include <fmt/format.h>
@@ -11,10 +14,13 @@
 #include "cell_array.hpp"
 #include "cell_list.hpp"
 #include "domain_builder.hpp"
+#include "memory_tracker.hpp"
 #include "mesh_config.hpp"
 #include "petsc/cell_ownership.hpp"
+#include "sfc.hpp"
 #include "static_algorithm.hpp"
 #include "stencil.hpp"
+#include "subset/cache.hpp"
 #include "subset/node.hpp"
 
 #ifdef SAMURAI_WITH_MPI
@@ -46,6 +52,16 @@ namespace samurai
         }
     };
 
+    namespace detail
+    {
+        // Version of the cells of a mesh: a new one is drawn each time the cells of a mesh are numbered
+        inline std::size_t new_mesh_version()
+        {
+            static std::atomic<std::size_t> last_version{0};
+            return ++last_version;
+        }
+    }
+
     template <class MeshType>
     struct MPI_Subdomain
     {
@@ -58,6 +74,29 @@ namespace samurai
         }
     };
 
+    /**
+     * Precomputed description of the ghost values exchanged with the neighbouring subdomains at one level.
+     * For each neighbour, the ranges of cell indices to send and to receive are stored in the order of the messages,
+     * together with the send/recv buffers which are kept between two ghost updates.
+     */
+    template <class index_t>
+    struct GhostExchangePlan
+    {
+        struct neighbour_plan
+        {
+            int rank = 0;
+            std::vector<std::array<index_t, 2>> send_ranges;
+            std::vector<std::array<index_t, 2>> recv_ranges;
+            std::size_t n_send_cells = 0;
+            std::size_t n_recv_cells = 0;
+            std::vector<std::byte> send_buffer;
+            std::vector<std::byte> recv_buffer;
+        };
+
+        bool is_built = false;
+        std::vector<neighbour_plan> neighbours;
+    };
+
     template <class D, class Config>
     class Mesh_base
     {
@@ -95,6 +134,8 @@ namespace samurai
         std::size_t nb_cells(std::size_t level, mesh_id_t mesh_id = mesh_id_t::reference) const;
 
         const ca_type& operator[](mesh_id_t mesh_id) const;
+
+        std::size_t version() const;
         ca_type& operator[](mesh_id_t mesh_id);
 
         std::size_t max_level() const;
@@ -162,6 +203,25 @@ namespace samurai
         CellOwnership& cell_ownership();
         const CellOwnership& cell_ownership() const;
 
+        double load_imbalance() const;
+        std::vector<double> load_balancing(std::size_t n_iterations = 10) const;
+        std::vector<ca_type> load_transfer(const std::vector<double>& load_fluxes);
+        template <class Func>
+        std::vector<ca_type> sfc_partition(Func&& weight) const;
+
+        template <std::size_t stencil_size>
+        StencilIndexCache<D, stencil_size>* stencil_index_cache(const Stencil<stencil_size, dim>& stencil) const;
+
+        SubsetCache<lca_type>& subset_cache() const;
+        MemoryHandle& memory_handle(mesh_id_t mesh_id) const;
+
+#ifdef SAMURAI_WITH_MPI
+        using ghost_exchange_plan_t = GhostExchangePlan<index_t>;
+
+        ghost_exchange_plan_t& ghost_exchange_plan(std::size_t level);
+        void invalidate_ghost_exchange_plans();
+#endif
+
       protected:
 
         using derived_type = D;
@@ -208,17 +268,16 @@ namespace samurai
 
         void construct_subdomain();
         void construct_domain();
-        void construct_union();
+        void construct_union(const self_type* ref_mesh = nullptr);
         void construct_corners();
-        void update_sub_mesh();
+        void update_sub_mesh(const self_type* ref_mesh = nullptr);
         void renumbering();
 
         void find_neighbourhood();
         void compute_gravity_center();
 
         void partition_mesh(std::size_t start_level, const Box<double, dim>& global_box);
-        void load_balancing();
-        void load_transfer(const std::vector<double>& load_fluxes);
+        auto sfc_key_function() const;
         std::size_t max_nb_cells(std::size_t level) const;
 
         lca_type m_domain;
@@ -231,6 +290,7 @@ namespace samurai
         coords_t m_gravity_center;
 
         mesh_config<dim> m_config;
+        std::size_t m_version = 0;
 
 #ifdef SAMURAI_WITH_MPI
         friend class boost::serialization::access;
@@ -252,6 +312,20 @@ namespace samurai
 #ifdef SAMURAI_WITH_PETSC
         CellOwnership m_cell_ownership;
 #endif
+
+        // Filled on demand by the stencil iterators if the option is enabled, cleared when the cells change
+        mutable StencilIndexCaches<D> m_stencil_index_caches;
+
+        // Filled on demand with the subsets used at each step, cleared when the cells change
+        mutable SubsetCache<lca_type> m_subset_cache;
+
+        // Entries of the memory tracker of the mesh ids (see track_memory())
+        mutable std::array<MemoryHandle, mesh_t::size> m_memory_handles;
+
+#ifdef SAMURAI_WITH_MPI
+        // Built on demand by update_ghost_subdomains(), invalidated when the mesh or its neighbourhood changes
+        std::array<ghost_exchange_plan_t, max_refinement_level + 1> m_ghost_exchange_plans;
+#endif
     };
 
     template <class D, class Config>
@@ -403,6 +477,14 @@ namespace samurai
 #endif
     }
 
+    /**
+     * Builds the mesh of the cells ca from a mesh with the same domain and configuration (typically the mesh before adaptation).
+     * What only depends on levels whose cells are unchanged is copied from ref_mesh: the union cells under the finest unchanged
+     * levels, and the ghost halo of each unchanged level (see MRMesh::update_sub_mesh_impl()).
+     * The reuse is by level, not by row: a level with one changed row is rebuilt entirely, as are the other mesh ids.
+     * The comparison of the cells of a level stops at the first different interval, and at once if the numbers of intervals
+     * differ (see BM_MeshFromReference for its cost when no level can be reused).
+     */
     template <class D, class Config>
     SAMURAI_INLINE Mesh_base<D, Config>::Mesh_base(const ca_type& ca, const self_type& ref_mesh)
         : m_domain(ref_mesh.m_domain)
@@ -412,8 +494,8 @@ namespace samurai
         m_cells[mesh_id_t::cells] = ca;
 
         construct_subdomain();
-        construct_union();
-        update_sub_mesh();
+        construct_union(&ref_mesh);
+        update_sub_mesh(&ref_mesh);
         construct_corners();
         renumbering();
         update_mesh_neighbour();
@@ -434,8 +516,8 @@ namespace samurai
         m_cells[mesh_id_t::cells] = {cl, false};
 
         construct_subdomain();
-        construct_union();
-        update_sub_mesh();
+        construct_union(&ref_mesh);
+        update_sub_mesh(&ref_mesh);
         construct_corners();
         renumbering();
         update_mesh_neighbour();
@@ -565,6 +647,16 @@ namespace samurai
         return m_cells[mesh_id];
     }
 
+    /**
+     * Number identifying the cells of the mesh: it changes each time the cells are rebuilt (construction, adaptation,
+     * load balancing), and is kept by the copies of the mesh.
+     */
+    template <class D, class Config>
+    SAMURAI_INLINE std::size_t Mesh_base<D, Config>::version() const
+    {
+        return m_version;
+    }
+
     template <class D, class Config>
     SAMURAI_INLINE auto Mesh_base<D, Config>::operator[](mesh_id_t mesh_id) -> ca_type&
     {
@@ -792,6 +884,54 @@ namespace samurai
         return m_mpi_neighbourhood;
     }
 
+    /**
+     * Returns the cache of the cell indices of the given stencil, or nullptr if the caching is disabled in the mesh config.
+     */
+    template <class D, class Config>
+    template <std::size_t stencil_size>
+    SAMURAI_INLINE auto Mesh_base<D, Config>::stencil_index_cache(const Stencil<stencil_size, dim>& stencil) const
+        -> StencilIndexCache<D, stencil_size>*
+    {
+        if (!m_config.cache_stencil_indices())
+        {
+            return nullptr;
+        }
+        return &m_stencil_index_caches.get(stencil);
+    }
+
+    /**
+     * Returns the cache of the materialized subsets of the mesh, cleared when the cells change.
+     */
+    template <class D, class Config>
+    SAMURAI_INLINE auto Mesh_base<D, Config>::subset_cache() const -> SubsetCache<lca_type>&
+    {
+        return m_subset_cache;
+    }
+
+    template <class D, class Config>
+    SAMURAI_INLINE MemoryHandle& Mesh_base<D, Config>::memory_handle(mesh_id_t mesh_id) const
+    {
+        return m_memory_handles[static_cast<std::size_t>(mesh_id)];
+    }
+
+#ifdef SAMURAI_WITH_MPI
+    template <class D, class Config>
+    SAMURAI_INLINE auto Mesh_base<D, Config>::ghost_exchange_plan(std::size_t level) -> ghost_exchange_plan_t&
+    {
+        return m_ghost_exchange_plans[level];
+    }
+
+    template <class D, class Config>
+    SAMURAI_INLINE void Mesh_base<D, Config>::invalidate_ghost_exchange_plans()
+    {
+        for (auto& plan : m_ghost_exchange_plans)
+        {
+            plan.is_built = false;
+            plan.neighbours.clear();
+        }
+    }
+#endif
+
     template <class D, class Config>
     const typename Mesh_base<D, Config>::coords_t& Mesh_base<D, Config>::gravity_center() const
     {
@@ -830,17 +970,43 @@ namespace samurai
         swap(m_mpi_neighbourhood, mesh.m_mpi_neighbourhood);
         swap(m_union, mesh.m_union);
         swap(m_config, mesh.m_config);
+        swap(m_version, mesh.m_version);
+        m_stencil_index_caches.clear();
+        mesh.m_stencil_index_caches.clear();
+        m_subset_cache.clear();
+        mesh.m_subset_cache.clear();
+#ifdef SAMURAI_WITH_MPI
+        invalidate_ghost_exchange_plans();
+        mesh.invalidate_ghost_exchange_plans();
+#endif
     }
 
+    /**
+     * Constructs the ghosts and the other mesh ids from the cells.
+     * If the mesh type supports it, the parts of ref_mesh which do not depend on the changed levels are reused.
+     */
     template <class D, class Config>
-    SAMURAI_INLINE void Mesh_base<D, Config>::update_sub_mesh()
+    SAMURAI_INLINE void Mesh_base<D, Config>::update_sub_mesh(const self_type* ref_mesh)
     {
-        this->derived_cast().update_sub_mesh_impl();
+        if constexpr (requires(D& mesh, const D* ref) { mesh.update_sub_mesh_impl(ref); })
+        {
+            this->derived_cast().update_sub_mesh_impl(ref_mesh ? &ref_mesh->derived_cast() : nullptr);
+        }
+        else
+        {
+            this->derived_cast().update_sub_mesh_impl();
+        }
     }
 
     template <class D, class Config>
     SAMURAI_INLINE void Mesh_base<D, Config>::renumbering()
     {
+#ifdef SAMURAI_WITH_MPI
+        invalidate_ghost_exchange_plans();
+#endif
+        m_stencil_index_caches.clear();
+        m_subset_cache.clear();
+        m_version = detail::new_mesh_version();
         m_cells[mesh_id_t::reference].update_index();
 
         for (std::size_t id = 0; id < static_cast<std::size_t>(mesh_id_t::count); ++id)
@@ -921,6 +1087,8 @@ namespace samurai
     SAMURAI_INLINE void Mesh_base<D, Config>::update_mesh_neighbour()
     {
 #ifdef SAMURAI_WITH_MPI
+        invalidate_ghost_exchange_plans();
+
         // send/recv the meshes of the neighbouring subdomains
         mpi::communicator world;
         std::vector<mpi::request> req;
@@ -961,6 +1129,8 @@ namespace samurai
     SAMURAI_INLINE void Mesh_base<D, Config>::update_neighbour_subdomain()
     {
 #ifdef SAMURAI_WITH_MPI
+        invalidate_ghost_exchange_plans();
+
         // send/recv the meshes of the neighbouring subdomains
         mpi::communicator world;
         std::vector<mpi::request> req;
@@ -991,6 +1161,8 @@ namespace samurai
     SAMURAI_INLINE void Mesh_base<D, Config>::update_meshid_neighbour([[maybe_unused]] const mesh_id_t& mesh_id)
     {
 #ifdef SAMURAI_WITH_MPI
+        invalidate_ghost_exchange_plans();
+
         mpi::communicator world;
         std::vector<mpi::request> req;
 
@@ -1070,10 +1242,14 @@ namespace samurai
 #endif
     }
 
+    /**
+     * If ref_mesh is given, the union of the levels under which the cells are the same as in ref_mesh is copied from it.
+     */
     template <class D, class Config>
-    SAMURAI_INLINE void Mesh_base<D, Config>::construct_union()
+    SAMURAI_INLINE void Mesh_base<D, Config>::construct_union(const self_type* ref_mesh)
     {
-        std::size_t max_lvl = max_level();
+        std::size_t max_lvl   = max_level();
+        bool same_finer_cells = ref_mesh && ref_mesh->max_level() == max_lvl;
 
         // Construction of union cells
         // ===========================
@@ -1091,6 +1267,13 @@ namespace samurai
         m_union[max_lvl] = {max_lvl};
         for (std::size_t level = max_lvl; level >= 1; --level)
         {
+            same_finer_cells = same_finer_cells && m_cells[mesh_id_t::cells][level] == ref_mesh->m_cells[mesh_id_t::cells][level];
+            if (same_finer_cells)
+            {
+                m_union[level - 1] = ref_mesh->m_union[level - 1];
+                continue;
+            }
+
             lcl_type lcl{level - 1};
             auto expr = union_(this->m_cells[mesh_id_t::cells][level], m_union[level]).on(level - 1);
 
@@ -1161,8 +1344,38 @@ namespace samurai
         std::size_t subdomain_start = 0;
         std::size_t subdomain_end   = 0;
         lcl_type subdomain_cells(start_level, m_domain.origin_point(), m_domain.scaling_factor());
+        if (m_config.partitioning() != Partitioning::Intervals)
+        {
+            // All the ranks know the whole domain: the cells are sorted along the space-filling curve
+            // and each rank takes its chunk, without communication.
+            auto sfc_key = sfc_key_function();
+            std::vector<std::pair<std::uint64_t, std::array<value_t, dim>>> cells;
+            cells.reserve(m_domain.nb_cells());
+            for_each_interval(m_domain,
+                              [&](std::size_t level, const auto& interval, const auto& index)
+                              {
+                                  std::array<value_t, dim> coords;
+                                  std::copy(index.begin(), index.end(), coords.begin() + 1);
+                                  for (auto i = interval.start; i < interval.end; ++i)
+                                  {
+                                      coords[0] = i;
+                                      cells.emplace_back(sfc_key(level, i, index), coords);
+                                  }
+                              });
+            std::sort(cells.begin(), cells.end());
+
+            subdomain_start = cells.size() * static_cast<std::size_t>(rank) / static_cast<std::size_t>(size);
+            subdomain_end   = cells.size() * (static_cast<std::size_t>(rank) + 1) / static_cast<std::size_t>(size);
+            typename lca_type::coord_type index;
+            for (std::size_t k = subdomain_start; k < subdomain_end; ++k)
+            {
+                const auto& coords = cells[k].second;
+                std::copy(coords.begin() + 1, coords.end(), index.begin());
+                subdomain_cells[index].add_point(coords[0]);
+            }
+        }
         // in 1D MPI, we need a specific partitioning
-        if (dim == 1)
+        else if (dim == 1)
         {
             std::size_t n_cells               = m_domain.nb_cells();
             std::size_t n_cells_per_subdomain = n_cells / static_cast<std::size_t>(size);
@@ -1210,81 +1423,327 @@ namespace samurai
 #endif
     }
 
+    /**
+     * Returns the function giving the position of the cell (level, i, index) along the space-filling curve
+     * chosen in the mesh configuration. The keys are computed at the finest level on the bounding box of the domain,
+     * so that they can be compared between the levels and between the MPI ranks.
+     */
     template <class D, class Config>
-    void Mesh_base<D, Config>::load_balancing()
+    auto Mesh_base<D, Config>::sfc_key_function() const
     {
-#ifdef SAMURAI_WITH_MPI
-        mpi::communicator world;
-        auto rank = world.rank();
+        std::size_t finest_level = std::max(max_level(), m_domain.level());
+        std::size_t domain_shift = finest_level - m_domain.level();
 
-        std::size_t load = nb_cells(mesh_id_t::cells);
-        std::vector<std::size_t> loads;
-
-        std::vector<double> load_fluxes(m_mpi_neighbourhood.size(), 0);
+        std::array<std::int64_t, dim> min_corner;
+        std::array<std::int64_t, dim> max_corner;
+        min_corner.fill(std::numeric_limits<std::int64_t>::max());
+        max_corner.fill(std::numeric_limits<std::int64_t>::min());
+        for_each_interval(m_domain,
+                          [&](std::size_t, const auto& interval, const auto& index)
+                          {
+                              min_corner[0] = std::min(min_corner[0], static_cast<std::int64_t>(interval.start));
+                              max_corner[0] = std::max(max_corner[0], static_cast<std::int64_t>(interval.end));
+                              for (std::size_t d = 1; d < dim; ++d)
+                              {
+                                  min_corner[d] = std::min(min_corner[d], static_cast<std::int64_t>(index[d - 1]));
+                                  max_corner[d] = std::max(max_corner[d], static_cast<std::int64_t>(index[d - 1]) + 1);
+                              }
+                          });
 
-        const std::size_t n_iterations = 1;
+        std::size_t n_bits = 0;
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            min_corner[d] <<= domain_shift;
+            auto extent = static_cast<std::uint64_t>((max_corner[d] << domain_shift) - min_corner[d]);
+            while ((std::uint64_t{1} << n_bits) < extent)
+            {
+                ++n_bits;
+            }
+        }
+        // The key must fit in 64 bits: if needed, the finest levels are merged.
+        std::size_t coarsening = (dim * n_bits > 63) ? n_bits - 63 / dim : 0;
+        n_bits -= coarsening;
 
-        for (std::size_t k = 0; k < n_iterations; ++k)
+        auto method = m_config.partitioning();
+        return [=](std::size_t level, auto i, const auto& index)
         {
-            world.barrier();
-            if (rank == 0)
+            std::size_t shift = finest_level - level;
+            std::array<std::uint64_t, dim> coords;
+            coords[0] = static_cast<std::uint64_t>((static_cast<std::int64_t>(i) << shift) - min_corner[0]) >> coarsening;
+            for (std::size_t d = 1; d < dim; ++d)
             {
-                std::cout << "---------------- k = " << k << " ----------------" << std::endl;
+                coords[d] = static_cast<std::uint64_t>((static_cast<std::int64_t>(index[d - 1]) << shift) - min_corner[d]) >> coarsening;
             }
-            mpi::all_gather(world, load, loads);
+            return sfc::key<dim>(method, coords, n_bits);
+        };
+    }
 
-            std::vector<std::size_t> nb_neighbours;
-            mpi::all_gather(world, m_mpi_neighbourhood.size(), nb_neighbours);
+    /**
+     * Computes a new partition of the leaf cells by cutting the space-filling curve chosen in the mesh configuration
+     * into chunks of equal weight, one per MPI rank. The weight of a cell is given by weight(level, i, index).
+     * The splitting keys are found by a parallel bisection, so the cells are never gathered on a single rank.
+     * This function is collective.
+     *
+     * @return for each rank, the cells of this subdomain that must be sent to it.
+     */
+    template <class D, class Config>
+    template <class Func>
+    auto Mesh_base<D, Config>::sfc_partition([[maybe_unused]] Func&& weight) const -> std::vector<ca_type>
+    {
+        std::vector<ca_type> cells_to_send;
+#ifdef SAMURAI_WITH_MPI
+        using coord_type = typename lca_type::coord_type;
 
-            double load_np1 = static_cast<double>(load);
-            for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
-            {
-                auto neighbour = m_mpi_neighbourhood[i_rank];
+        struct sfc_cell
+        {
+            std::uint64_t key;
+            std::size_t level;
+            value_t i;
+            coord_type index;
+        };
+
+        mpi::communicator world;
+        auto size = static_cast<std::size_t>(world.size());
+        cells_to_send.resize(size);
 
-                auto neighbour_load = loads[static_cast<std::size_t>(neighbour.rank)];
-                int neighbour_load_minus_my_load;
-                if (load < neighbour_load)
+        auto sfc_key = sfc_key_function();
+
+        std::vector<sfc_cell> cells;
+        std::vector<double> weights;
+        cells.reserve(nb_cells(mesh_id_t::cells));
+        for_each_interval(m_cells[mesh_id_t::cells],
+                          [&](std::size_t level, const auto& interval, const auto& index)
+                          {
+                              for (auto i = interval.start; i < interval.end; ++i)
+                              {
+                                  cells.push_back({sfc_key(level, i, index), level, i, index});
+                              }
+                          });
+        std::sort(cells.begin(),
+                  cells.end(),
+                  [](const auto& a, const auto& b)
+                  {
+                      return a.key < b.key;
+                  });
+
+        // cumulated_weights[k] is the weight of the k first cells along the curve
+        std::vector<double> cumulated_weights(cells.size() + 1, 0.);
+        for (std::size_t k = 0; k < cells.size(); ++k)
+        {
+            cumulated_weights[k + 1] = cumulated_weights[k] + weight(cells[k].level, cells[k].i, cells[k].index);
+        }
+        double total_weight = mpi::all_reduce(world, cumulated_weights.back(), std::plus<double>());
+
+        auto local_weight_below = [&](std::uint64_t key)
+        {
+            auto it = std::lower_bound(cells.begin(),
+                                       cells.end(),
+                                       key,
+                                       [](const auto& cell, std::uint64_t k)
+                                       {
+                                           return cell.key < k;
+                                       });
+            return cumulated_weights[static_cast<std::size_t>(it - cells.begin())];
+        };
+
+        // Bisection on the keys: splitters[r] is the smallest key such that the weight of the cells before it
+        // is at least (r+1) * total_weight / size.
+        std::uint64_t max_key = mpi::all_reduce(world, cells.empty() ? std::uint64_t{0} : cells.back().key, mpi::maximum<std::uint64_t>());
+        std::vector<std::uint64_t> lower(size - 1, 0);
+        std::vector<std::uint64_t> splitters(size - 1, max_key + 1);
+        std::vector<std::uint64_t> middle(size - 1);
+        std::vector<double> local_weights(size - 1);
+        std::vector<double> global_weights(size - 1);
+        while (lower != splitters)
+        {
+            for (std::size_t r = 0; r < size - 1; ++r)
+            {
+                middle[r]        = lower[r] + (splitters[r] - lower[r]) / 2;
+                local_weights[r] = local_weight_below(middle[r]);
+            }
+            mpi::all_reduce(world, local_weights.data(), static_cast<int>(size - 1), global_weights.data(), std::plus<double>());
+            for (std::size_t r = 0; r < size - 1; ++r)
+            {
+                if (global_weights[r] >= static_cast<double>(r + 1) * total_weight / static_cast<double>(size))
                 {
-                    neighbour_load_minus_my_load = static_cast<int>(neighbour_load - load);
+                    splitters[r] = middle[r];
                 }
                 else
                 {
-                    neighbour_load_minus_my_load = -static_cast<int>(load - neighbour_load);
+                    lower[r] = middle[r] + 1;
                 }
-                double weight       = 1. / std::max(m_mpi_neighbourhood.size(), nb_neighbours[neighbour.rank]);
-                load_fluxes[i_rank] = weight * neighbour_load_minus_my_load;
-                load_np1 += load_fluxes[i_rank];
             }
-            load_np1 = floor(load_np1);
+        }
 
-            load_transfer(load_fluxes);
+        std::vector<cl_type> cl(size);
+        for (const auto& cell : cells)
+        {
+            // The cell with the key splitters[r] is the first one of rank r+1
+            auto dest = static_cast<std::size_t>(std::upper_bound(splitters.begin(), splitters.end(), cell.key) - splitters.begin());
+            if (dest != static_cast<std::size_t>(world.rank()))
+            {
+                cl[dest][cell.level][cell.index].add_point(cell.i);
+            }
+        }
+        for (std::size_t r = 0; r < size; ++r)
+        {
+            cells_to_send[r] = {cl[r], false};
+        }
+#endif
+        return cells_to_send;
+    }
 
-            std::cout << rank << ": load = " << load << ", load_np1 = " << load_np1 << std::endl;
+    /**
+     * Relative load imbalance between the MPI subdomains, i.e. max_load / mean_load - 1,
+     * where the load of a subdomain is its number of cells.
+     * This function is collective.
+     */
+    template <class D, class Config>
+    double Mesh_base<D, Config>::load_imbalance() const
+    {
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
 
-            load = static_cast<std::size_t>(load_np1);
-        }
+        std::size_t load       = nb_cells(mesh_id_t::cells);
+        std::size_t max_load   = mpi::all_reduce(world, load, mpi::maximum<std::size_t>());
+        std::size_t total_load = mpi::all_reduce(world, load, std::plus<std::size_t>());
+
+        double mean_load = static_cast<double>(total_load) / static_cast<double>(world.size());
+        return (mean_load > 0) ? static_cast<double>(max_load) / mean_load - 1 : 0;
+#else
+        return 0;
 #endif
     }
 
+    /**
+     * Computes the load fluxes with the neighbouring subdomains by a diffusion process.
+     * The fluxes are accumulated over the iterations without moving any cell: the transfer
+     * is done at once by load_transfer().
+     * For each neighbour, a negative flux means that load must be sent to it, a positive flux
+     * that load will be received from it.
+     * This function is collective.
+     */
     template <class D, class Config>
-    void Mesh_base<D, Config>::load_transfer([[maybe_unused]] const std::vector<double>& load_fluxes)
+    std::vector<double> Mesh_base<D, Config>::load_balancing([[maybe_unused]] std::size_t n_iterations) const
     {
+        std::vector<double> load_fluxes(m_mpi_neighbourhood.size(), 0);
 #ifdef SAMURAI_WITH_MPI
         mpi::communicator world;
-        std::cout << world.rank() << ": ";
-        for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
+
+        std::vector<std::size_t> nb_neighbours;
+        mpi::all_gather(world, m_mpi_neighbourhood.size(), nb_neighbours);
+
+        double load = static_cast<double>(nb_cells(mesh_id_t::cells));
+        std::vector<double> loads;
+
+        for (std::size_t k = 0; k < n_iterations; ++k)
+        {
+            mpi::all_gather(world, load, loads);
+
+            double load_np1 = load;
+            for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
+            {
+                auto neighbour_rank = static_cast<std::size_t>(m_mpi_neighbourhood[i_rank].rank);
+
+                // The +1 ensures the convergence of the diffusion (without it, two ranks would swap their loads).
+                double weight = 1. / static_cast<double>(std::max(m_mpi_neighbourhood.size(), nb_neighbours[neighbour_rank]) + 1);
+                double flux   = weight * (loads[neighbour_rank] - load);
+                load_fluxes[i_rank] += flux;
+                load_np1 += flux;
+            }
+            load = load_np1;
+        }
+#endif
+        return load_fluxes;
+    }
+
+    /**
+     * Selects the cells to send to each neighbour according to the load fluxes computed by load_balancing().
+     * The cells sent to a neighbour are the ones closest to its gravity center, so that the subdomains stay compact.
+     * Each subdomain keeps at least one cell.
+     */
+    template <class D, class Config>
+    auto Mesh_base<D, Config>::load_transfer([[maybe_unused]] const std::vector<double>& load_fluxes) -> std::vector<ca_type>
+    {
+        std::vector<ca_type> cells_to_send(m_mpi_neighbourhood.size());
+#ifdef SAMURAI_WITH_MPI
+        using coord_type = typename lca_type::coord_type;
+
+        struct candidate_cell
         {
-            auto neighbour = m_mpi_neighbourhood[i_rank];
-            if (load_fluxes[i_rank] < 0) // must tranfer load to the neighbour
+            std::size_t level;
+            value_t i;
+            coord_type index;
+            double distance;
+        };
+
+        std::vector<candidate_cell> candidates;
+        candidates.reserve(nb_cells(mesh_id_t::cells));
+        for_each_interval(m_cells[mesh_id_t::cells],
+                          [&](std::size_t level, const auto& interval, const auto& index)
+                          {
+                              for (auto i = interval.start; i < interval.end; ++i)
+                              {
+                                  candidates.push_back({level, i, index, 0.});
+                              }
+                          });
+
+        // The neighbours with the largest outgoing fluxes choose their cells first
+        std::vector<std::size_t> order(m_mpi_neighbourhood.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(),
+                  order.end(),
+                  [&](std::size_t a, std::size_t b)
+                  {
+                      return load_fluxes[a] < load_fluxes[b];
+                  });
+
+        // The selected cells are moved at the end of the candidates, so that they can't be selected twice.
+        std::size_t n_candidates = candidates.size();
+        for (auto i_rank : order)
+        {
+            if (load_fluxes[i_rank] > -1 || n_candidates <= 1)
+            {
+                continue;
+            }
+            auto n_send = std::min(static_cast<std::size_t>(-load_fluxes[i_rank]), n_candidates - 1);
+
+            auto& neighbour = m_mpi_neighbourhood[i_rank];
+            neighbour.mesh.compute_gravity_center();
+            const auto& center = neighbour.mesh.gravity_center();
+
+            for (std::size_t c = 0; c < n_candidates; ++c)
             {
+                auto& cell    = candidates[c];
+                double length = cell_length(cell.level);
+                double x      = origin_point()[0] + length * (static_cast<double>(cell.i) + 0.5) - center[0];
+                cell.distance = x * x;
+                for (std::size_t d = 1; d < dim; ++d)
+                {
+                    x = origin_point()[d] + length * (static_cast<double>(cell.index[d - 1]) + 0.5) - center[d];
+                    cell.distance += x * x;
+                }
             }
-            else if (load_fluxes[i_rank] > 0) // must receive load from the neighbour
+
+            auto first_selected = candidates.begin() + static_cast<std::ptrdiff_t>(n_candidates - n_send);
+            std::nth_element(candidates.begin(),
+                             first_selected,
+                             candidates.begin() + static_cast<std::ptrdiff_t>(n_candidates),
+                             [](const auto& a, const auto& b)
+                             {
+                                 return a.distance > b.distance;
+                             });
+
+            cl_type cl;
+            for (auto it = first_selected; it != candidates.begin() + static_cast<std::ptrdiff_t>(n_candidates); ++it)
             {
+                cl[it->level][it->index].add_point(it->i);
             }
-            std::cout << "--> " << neighbour.rank << ": " << load_fluxes[i_rank] << ", ";
+            cells_to_send[i_rank] = {cl, false};
+            n_candidates -= n_send;
         }
-        std::cout << std::endl;
 #endif
+        return cells_to_send;
     }
 
     template <class D, class Config>
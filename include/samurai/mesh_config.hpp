@@ -6,6 +6,7 @@
 #include "arguments.hpp"
 #include "cell_array.hpp"
 #include "samurai_config.hpp"
+#include "sfc.hpp"
 
 #include <array>
 
@@ -333,6 +334,61 @@ namespace samurai
             return m_periodic[i];
         }
 
+        // m_partitioning ---------------------------------
+
+        /**
+         * @brief set the method used to distribute the cells between the MPI subdomains in chained config
+         *
+         * @param method
+         * @return auto& returns this object
+         */
+        auto& partitioning(Partitioning method)
+        {
+            m_partitioning = method;
+            return *this;
+        }
+
+        /**
+         * @brief get a reference on the partitioning method
+         */
+        auto& partitioning()
+        {
+            return m_partitioning;
+        }
+
+        /**
+         * @brief get a reference on the partitioning method
+         */
+        const auto& partitioning() const
+        {
+            return m_partitioning;
+        }
+
+        // m_cache_stencil_indices -----------------------
+
+        /**
+         * @brief set in chained config if the cell indices of the stencils are cached by the mesh
+         *
+         * The lookups in the mesh done by the schemes are then only done once as long as the mesh does not change,
+         * at the cost of the memory used by the caches.
+         *
+         * @param cache
+         * @return auto& returns this object
+         */
+        auto& cache_stencil_indices(bool cache)
+        {
+            m_cache_stencil_indices = cache;
+            return *this;
+        }
+
+        /**
+         * @brief get if the cell indices of the stencils are cached by the mesh
+         */
+        bool cache_stencil_indices() const
+        {
+            return m_cache_stencil_indices;
+        }
+
         // m_disable_args_parse ---------------------------
 
         /**
@@ -378,6 +434,14 @@ namespace samurai
                 {
                     m_start_level = args::start_level;
                 }
+                if (!args::partitioning.empty())
+                {
+                    m_partitioning = partitioning_from_string(args::partitioning);
+                }
+                if (args::cache_stencil_indices)
+                {
+                    m_cache_stencil_indices = true;
+                }
                 if (m_max_level < m_min_level)
                 {
                     std::cerr << "Max level must be greater than min level." << std::endl;
@@ -410,6 +474,8 @@ namespace samurai
             ar & m_max_level;
             ar & m_approx_box_tol;
             ar & m_scaling_factor;
+            ar & m_partitioning;
+            ar & m_cache_stencil_indices;
             ar & m_disable_args_parse;
         }
 #endif
@@ -427,6 +493,9 @@ namespace samurai
 
         std::array<bool, dim> m_periodic;
 
+        Partitioning m_partitioning  = Partitioning::Intervals;
+        bool m_cache_stencil_indices = false;
+
         bool m_disable_args_parse          = false;
         bool m_disable_minimal_ghost_width = false;
     };
@@ -13,7 +13,9 @@
 #include "../arguments.hpp"
 #include "../boundary.hpp"
 #include "../field.hpp"
-#include "../timers.hpp"
+#include "../load_balancing.hpp"
+#include "../memory.hpp"
+#include "../profiling.hpp"
 #include "config.hpp"
 #include "criteria.hpp"
 #include "operators.hpp"
@@ -103,6 +105,12 @@ namespace samurai
         template <class... Fields>
         void operator()(double eps, double regularity, Fields&... other_fields);
 
+        /**
+         * Configuration of the load balancing done after the adaptation when the mesh is partitioned along a space-filling curve.
+         * Setting its frequency to 0 disables it.
+         */
+        load_balancing_config& load_balancing();
+
       private:
 
         using inner_fields_type = detail::get_fields_type<TField, TFields...>;
@@ -126,6 +134,8 @@ namespace samurai
         fields_t m_fields; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
         detail_t m_detail;
         tag_t m_tag;
+        load_balancing_config m_load_balancing_cfg;
+        LoadBalancer<TField, TFields...> m_load_balancer;
     };
 
     template <bool enlarge_, class PredictionFn, class TField, class... TFields>
@@ -134,7 +144,14 @@ namespace samurai
         , m_fields(field, fields...)
         , m_detail("detail", field.mesh())
         , m_tag("tag", field.mesh())
+        , m_load_balancer(field, fields...)
+    {
+    }
+
+    template <bool enlarge_, class PredictionFn, class TField, class... TFields>
+    SAMURAI_INLINE load_balancing_config& Adapt<enlarge_, PredictionFn, TField, TFields...>::load_balancing()
     {
+        return m_load_balancing_cfg;
     }
 
     template <bool enlarge_, class PredictionFn, class TField, class... TFields>
@@ -150,21 +167,32 @@ namespace samurai
             return;
         }
 
-        times::timers.start("mesh adaptation");
-        cfg.parse_args();
-        for (std::size_t i = 0; i < max_level - min_level; ++i)
         {
-            // std::cout << "MR mesh adaptation " << i << std::endl;
-            m_detail.resize();
-            m_detail.fill(0);
-            m_tag.resize();
-            m_tag.fill(0);
-            if (harten(i, cfg, other_fields...))
+            SAMURAI_PROFILE_REGION("mesh adaptation");
+            cfg.parse_args();
+            for (std::size_t i = 0; i < max_level - min_level; ++i)
             {
-                break;
+                // std::cout << "MR mesh adaptation " << i << std::endl;
+                m_detail.resize();
+                m_detail.fill(0);
+                m_tag.resize();
+                m_tag.fill(0);
+                m_detail.memory_handle().update("adaptation", m_detail.name(), memory_usage(m_detail));
+                m_tag.memory_handle().update("adaptation", m_tag.name(), memory_usage(m_tag));
+                if (harten(i, cfg, other_fields...))
+                {
+                    break;
+                }
             }
         }
-        times::timers.stop("mesh adaptation");
+
+        // With a space-filling curve partitioning, the adapted mesh is redistributed if it became unbalanced.
+        if (mesh.cfg().partitioning() != Partitioning::Intervals)
+        {
+            m_load_balancer(m_load_balancing_cfg, other_fields...);
+        }
+
+        track_memory(mesh, m_fields, other_fields...);
     }
 
     template <bool enlarge_, class PredictionFn, class TField, class... TFields>
@@ -250,9 +278,9 @@ namespace samurai
     template <class... Fields>
     bool Adapt<enlarge_, PredictionFn, TField, TFields...>::harten(std::size_t ite, const mra_config& cfg, Fields&... other_fields)
     {
+        SAMURAI_PROFILE_REGION("harten");
         auto& mesh = m_fields.mesh();
 
-        times::timers.start("mesh adaptation");
         std::size_t min_level = mesh.min_level();
         std::size_t max_level = mesh.max_level();
 
@@ -267,9 +295,7 @@ namespace samurai
             update_tag_subdomains(level, m_tag, true);
         }
 
-        times::timers.stop("mesh adaptation");
         update_ghost_mr(m_fields);
-        times::timers.start("mesh adaptation");
 
         //--------------------//
         // Detail computation //
@@ -290,8 +316,9 @@ namespace samurai
         {
             // 1. detail computation in the cells (at level+1)
             auto ghosts_below_cells = intersection(mesh[mesh_id_t::all_cells][level], mesh[mesh_id_t::cells][level + 1]).on(level);
-            ghosts_below_cells.apply_op(compute_detail(m_detail, m_fields)); // 'compute_detail' applies 1 level above the set
-                                                                             // it is applied to, i.e. level+1
+            // 'compute_detail' applies 1 level above the set it is applied to, i.e. level+1:
+            // each row of the set writes the details of its own children, so that the rows can be processed in parallel
+            ghosts_below_cells.template apply_op<Run::Parallel>(compute_detail(m_detail, m_fields));
 
             // 2. detail computation in the ghosts below cells (at level)
             if (level >= min_level)
@@ -299,7 +326,7 @@ namespace samurai
                 if (periodic_in_all_directions)
                 {
                     auto ghosts_2_levels_below_cells = intersection(mesh[mesh_id_t::all_cells][level - 1], ghosts_below_cells).on(level - 1);
-                    ghosts_2_levels_below_cells.apply_op(compute_detail(m_detail, m_fields));
+                    ghosts_2_levels_below_cells.template apply_op<Run::Parallel>(compute_detail(m_detail, m_fields));
                 }
                 else
                 {
@@ -314,10 +341,8 @@ namespace samurai
                     auto cells_without_bdry  = intersection(mesh[mesh_id_t::cells][level + 1], domain_without_bdry);
                     auto ghosts_below_cells2 = intersection(mesh[mesh_id_t::all_cells][level], cells_without_bdry).on(level);
                     auto ghosts_2_levels_below_cells = intersection(mesh[mesh_id_t::all_cells][level - 1], ghosts_below_cells2).on(level - 1);
-                    ghosts_2_levels_below_cells.apply_op(compute_detail(m_detail, m_fields)); // 'compute_detail' applies 1
-                                                                                              // level above the set it is
-                                                                                              // applied to, i.e. 1 level below
-                                                                                              // cells
+                    // 'compute_detail' applies 1 level above the set it is applied to, i.e. 1 level below cells
+                    ghosts_2_levels_below_cells.template apply_op<Run::Parallel>(compute_detail(m_detail, m_fields));
                 }
             }
         }
@@ -381,20 +406,29 @@ namespace samurai
 
         ca_type new_ca = update_cell_array_from_tag(mesh[mesh_id_t::cells], m_tag);
         make_graduation(new_ca, mesh.domain(), mesh.mpi_neighbourhood(), mesh.periodicity(), mesh.graduation_width(), mesh.max_stencil_radius());
-        mesh_t new_mesh{new_ca, mesh};
+
+        // The comparison is done on the cells only, so that the mesh is not rebuilt when nothing has changed
+        bool unchanged = true;
+        for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+        {
+            unchanged = unchanged && new_ca[level] == mesh[mesh_id_t::cells][level];
+        }
 #ifdef SAMURAI_WITH_MPI
         mpi::communicator world;
-        if (mpi::all_reduce(world, mesh == new_mesh, std::logical_and()))
+        if (mpi::all_reduce(world, unchanged, std::logical_and()))
 #else
-        if (mesh == new_mesh)
+        if (unchanged)
 #endif // SAMURAI_WITH_MPI
         {
             return true;
         }
 
-        times::timers.stop("mesh adaptation");
+        // The ghosts and the union of the unchanged levels are reused from the current mesh
+        mesh_t new_mesh{new_ca, mesh};
+        // recorded while the current mesh is alive, so that the peak of the adaptation is tracked
+        track_memory(new_mesh);
+
         update_ghost_mr(other_fields...);
-        times::timers.start("mesh adaptation");
 
         update_fields(std::forward<PredictionFn>(m_prediction_fn), new_mesh, m_fields, other_fields...);
         m_fields.mesh().swap(new_mesh);
@@ -107,7 +107,7 @@ namespace samurai
                double approx_box_tol = lca_type::default_approx_box_tol,
                double scaling_factor = 0);
 
-        void update_sub_mesh_impl();
+        void update_sub_mesh_impl(const self_type* ref_mesh = nullptr);
 
         template <typename... T>
         xt::xtensor<bool, 1> exists(mesh_id_t type, std::size_t level, interval_t interval, T... index) const;
@@ -206,7 +206,7 @@ namespace samurai
     }
 
     template <class Config>
-    SAMURAI_INLINE void MRMesh<Config>::update_sub_mesh_impl()
+    SAMURAI_INLINE void MRMesh<Config>::update_sub_mesh_impl(const self_type* ref_mesh)
     {
 #ifdef SAMURAI_WITH_MPI
         mpi::communicator world;
@@ -236,20 +236,39 @@ namespace samurai
         //
         // level 0 |.......|-------|.......|       |.......|-------|.......|
         //
-        for_each_interval(this->cells()[mesh_id_t::cells],
-                          [&](std::size_t level, const auto& interval, const auto& index_yz)
-                          {
-                              lcl_type& lcl = cell_list[level];
-                              static_nested_loop<dim - 1>(
-                                  -max_stencil_radius(),
-                                  max_stencil_radius() + 1,
-                                  [&](auto stencil)
+        // The ghosts of a level only depend on the cells of this level: they are copied from ref_mesh
+        // (the mesh before adaptation) for the levels where the cells have not changed.
+        auto& cells_and_ghosts = this->cells()[mesh_id_t::cells_and_ghosts];
+        for (std::size_t level = 0; level <= this->max_level(); ++level)
+        {
+            const auto& lca_cells = this->cells()[mesh_id_t::cells][level];
+            lcl_type& lcl         = cell_list[level];
+
+            if (ref_mesh && ref_mesh->max_level() == this->max_level() && lca_cells == (*ref_mesh)[mesh_id_t::cells][level])
+            {
+                cells_and_ghosts[level] = (*ref_mesh)[mesh_id_t::cells_and_ghosts][level];
+                for_each_interval(cells_and_ghosts[level],
+                                  [&](std::size_t, const auto& interval, const auto& index_yz)
                                   {
-                                      auto index = xt::eval(index_yz + stencil);
-                                      lcl[index].add_interval({interval.start - max_stencil_radius(), interval.end + max_stencil_radius()});
+                                      lcl[index_yz].add_interval(interval);
                                   });
-                          });
-        this->cells()[mesh_id_t::cells_and_ghosts] = {cell_list, false};
+                continue;
+            }
+
+            for_each_interval(lca_cells,
+                              [&](std::size_t, const auto& interval, const auto& index_yz)
+                              {
+                                  static_nested_loop<dim - 1>(
+                                      -max_stencil_radius(),
+                                      max_stencil_radius() + 1,
+                                      [&](auto stencil)
+                                      {
+                                          auto index = xt::eval(index_yz + stencil);
+                                          lcl[index].add_interval({interval.start - max_stencil_radius(), interval.end + max_stencil_radius()});
+                                      });
+                              });
+            cells_and_ghosts[level] = {lcl};
+        }
 
         // Add cells for the MRA
         if (this->max_level() != this->min_level())
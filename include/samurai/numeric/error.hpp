@@ -1,5 +1,5 @@
 #pragma once
-#include "../timers.hpp"
+#include "../profiling.hpp"
 #include "gauss_legendre.hpp"
 
 namespace samurai
@@ -27,7 +27,7 @@ namespace samurai
     template <bool relative_error, class Field, class Func>
     double L2_error(Field& approximate, Func&& exact)
     {
-        times::timers.start("error computation");
+        SAMURAI_PROFILE_REGION("error computation");
 
         // In FV, we want only 1 quadrature point.
         // This is equivalent to
@@ -65,8 +65,6 @@ namespace samurai
         error_norm    = sqrt(error_norm);
         solution_norm = sqrt(solution_norm);
 
-        times::timers.stop("error computation");
-
         if constexpr (relative_error)
         {
             return error_norm / solution_norm;
@@ -0,0 +1,116 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "samurai_config.hpp"
+
+namespace samurai::detail
+{
+    /**
+     * Dense table giving, for each coordinate of the outermost dimension of a LevelCellArray, its position in the offsets
+     * of this dimension, i.e. the range of intervals of the next dimension.
+     * find() then reaches a row in O(1) instead of scanning the intervals of the outermost dimension.
+     *
+     * The table is built on the first search, and only if it is dense enough: at most two entries per existing row.
+     * It is reset when the outermost intervals are modified; the copies start empty.
+     */
+    template <class value_t>
+    class OuterRowIndex
+    {
+      public:
+
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        OuterRowIndex() = default;
+
+        OuterRowIndex(const OuterRowIndex&)
+        {
+        }
+
+        OuterRowIndex& operator=(const OuterRowIndex&)
+        {
+            reset();
+            return *this;
+        }
+
+        ~OuterRowIndex() = default;
+
+        void reset()
+        {
+            m_built.store(false, std::memory_order_release);
+        }
+
+        /**
+         * Returns the index of lca, built if needed, or nullptr if the outermost dimension is too sparse for a dense table.
+         */
+        template <class LCA>
+        const OuterRowIndex* get(const LCA& lca) const
+        {
+            if (!m_built.load(std::memory_order_acquire))
+            {
+                std::lock_guard lock(m_mutex);
+                if (!m_built.load(std::memory_order_relaxed))
+                {
+                    build(lca);
+                    m_built.store(true, std::memory_order_release);
+                }
+            }
+            return m_enabled ? this : nullptr;
+        }
+
+        /// Position of the outermost coordinate c in the offsets, npos if c is not in the array.
+        SAMURAI_INLINE std::size_t row(value_t c) const
+        {
+            auto i = static_cast<std::size_t>(c - m_min);
+            return (c >= m_min && i < m_rows.size()) ? m_rows[i] : npos;
+        }
+
+      private:
+
+        template <class LCA>
+        void build(const LCA& lca) const
+        {
+            static constexpr std::size_t dim = LCA::dim;
+
+            m_enabled = false;
+            m_rows.clear();
+
+            const auto& outer = lca[dim - 1];
+            if (outer.empty())
+            {
+                return;
+            }
+
+            m_min             = outer.front().start;
+            auto extent       = static_cast<std::size_t>(outer.back().end - m_min);
+            std::size_t nrows = lca.offsets(dim - 1).size() - 1;
+            if (extent > 2 * nrows + 64)
+            {
+                return;
+            }
+
+            m_rows.assign(extent, npos);
+            for (const auto& interval : outer)
+            {
+                for (auto c = interval.start; c < interval.end; ++c)
+                {
+                    m_rows[static_cast<std::size_t>(c - m_min)] = static_cast<std::size_t>(interval.index + c);
+                }
+            }
+            m_enabled = true;
+        }
+
+        mutable std::mutex m_mutex;
+        mutable std::atomic<bool> m_built{false};
+        mutable bool m_enabled = false;
+        mutable value_t m_min  = 0;
+        mutable std::vector<std::size_t> m_rows;
+    };
+} // namespace samurai::detail
@@ -0,0 +1,199 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#if defined(SAMURAI_WITH_PERF_COUNTERS) && defined(__linux__)
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace samurai::profiling
+{
+    /**
+     * Values of the hardware counters of a thread.
+     */
+    struct CounterValues
+    {
+        std::uint64_t cycles       = 0;
+        std::uint64_t instructions = 0;
+        std::uint64_t llc_misses   = 0;
+
+        CounterValues& operator+=(const CounterValues& other)
+        {
+            cycles += other.cycles;
+            instructions += other.instructions;
+            llc_misses += other.llc_misses;
+            return *this;
+        }
+
+        CounterValues operator-(const CounterValues& other) const
+        {
+            return {cycles - other.cycles, instructions - other.instructions, llc_misses - other.llc_misses};
+        }
+    };
+
+#if defined(SAMURAI_WITH_PERF_COUNTERS) && defined(__linux__)
+    /**
+     * Hardware counters of the calling thread, read with perf_event_open.
+     *
+     * The events exclude the kernel, so that they can be opened without root when /proc/sys/kernel/perf_event_paranoid <= 2.
+     * On x86-64, the counters are read in user space with rdpmc, through the page mapped for each event,
+     * which avoids a system call at each read. Otherwise, or when the event is not scheduled on a counter, they are read with read().
+     * The counters which cannot be opened (no PMU in a virtual machine, paranoid level too high, ...) are reported as 0.
+     *
+     * The counters are opened for the thread which constructs the object: it must be used by this thread only.
+     */
+    class PerfCounters
+    {
+      public:
+
+        static constexpr bool enabled = true;
+
+        PerfCounters()
+        {
+            static constexpr std::array<std::uint64_t, nb_events> configs = {PERF_COUNT_HW_CPU_CYCLES,
+                                                                             PERF_COUNT_HW_INSTRUCTIONS,
+                                                                             PERF_COUNT_HW_CACHE_MISSES};
+            for (std::size_t i = 0; i < nb_events; ++i)
+            {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size           = sizeof(attr);
+                attr.type           = PERF_TYPE_HARDWARE;
+                attr.config         = configs[i];
+                attr.exclude_kernel = 1;
+                attr.exclude_hv     = 1;
+
+                m_fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+                if (m_fds[i] < 0)
+                {
+                    continue;
+                }
+                void* page = mmap(nullptr, static_cast<std::size_t>(sysconf(_SC_PAGESIZE)), PROT_READ, MAP_SHARED, m_fds[i], 0);
+                m_pages[i] = (page == MAP_FAILED) ? nullptr : static_cast<perf_event_mmap_page*>(page);
+            }
+        }
+
+        ~PerfCounters()
+        {
+            for (std::size_t i = 0; i < nb_events; ++i)
+            {
+                if (m_pages[i])
+                {
+                    munmap(m_pages[i], static_cast<std::size_t>(sysconf(_SC_PAGESIZE)));
+                }
+                if (m_fds[i] >= 0)
+                {
+                    close(m_fds[i]);
+                }
+            }
+        }
+
+        PerfCounters(const PerfCounters&)            = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        /**
+         * True if at least one counter could be opened.
+         */
+        bool available() const
+        {
+            return m_fds[0] >= 0 || m_fds[1] >= 0 || m_fds[2] >= 0;
+        }
+
+        CounterValues read() const
+        {
+            return {read_event(0), read_event(1), read_event(2)};
+        }
+
+      private:
+
+        static constexpr std::size_t nb_events = 3;
+
+        std::uint64_t read_event(std::size_t i) const
+        {
+            if (m_fds[i] < 0)
+            {
+                return 0;
+            }
+#if defined(__x86_64__)
+            if (const auto* page = m_pages[i])
+            {
+                // Protocol described in the manual of perf_event_open: the page is updated by the kernel under a sequence lock
+                std::uint32_t seq;
+                std::int64_t count;
+                bool user_read;
+                do
+                {
+                    seq = page->lock;
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                    std::uint32_t index = page->index;
+                    count               = page->offset;
+                    user_read           = page->cap_user_rdpmc && index != 0;
+                    if (user_read)
+                    {
+                        auto pmc = static_cast<std::int64_t>(rdpmc(index - 1));
+                        // sign extension of the counter width
+                        pmc <<= 64 - page->pmc_width;
+                        pmc >>= 64 - page->pmc_width;
+                        count += pmc;
+                    }
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                } while (page->lock != seq);
+
+                if (user_read)
+                {
+                    return static_cast<std::uint64_t>(count);
+                }
+            }
+#endif
+            std::uint64_t value = 0;
+            if (::read(m_fds[i], &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value)))
+            {
+                return 0;
+            }
+            return value;
+        }
+
+#if defined(__x86_64__)
+        static std::uint64_t rdpmc(std::uint32_t counter)
+        {
+            std::uint32_t low;
+            std::uint32_t high;
+            asm volatile("rdpmc" : "=a"(low), "=d"(high) : "c"(counter));
+            return (static_cast<std::uint64_t>(high) << 32) | low;
+        }
+#endif
+
+        std::array<int, nb_events> m_fds                     = {-1, -1, -1};
+        std::array<perf_event_mmap_page*, nb_events> m_pages = {nullptr, nullptr, nullptr};
+    };
+#else
+    /**
+     * Hardware counters disabled: configure with SAMURAI_WITH_PERF_COUNTERS=ON (Linux only) to enable them.
+     */
+    class PerfCounters
+    {
+      public:
+
+        static constexpr bool enabled = false;
+
+        bool available() const
+        {
+            return false;
+        }
+
+        CounterValues read() const
+        {
+            return {};
+        }
+    };
+#endif
+}
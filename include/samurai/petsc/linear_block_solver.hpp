@@ -122,16 +122,18 @@ namespace samurai
                         after_matrix_assembly(m_ksp, pc, m_A);
                     }
 
-                    times::timers.start("solver setup");
-                    PetscErrorCode err = PCSetUp(pc);
-                    // PetscErrorCode err = KSPSetUp(m_ksp); // PETSc fails at KSPSolve() for some reason.
+                    PetscErrorCode err;
+                    {
+                        SAMURAI_PROFILE_REGION("solver setup");
+                        err = PCSetUp(pc);
+                        // err = KSPSetUp(m_ksp); // PETSc fails at KSPSolve() for some reason.
+                    }
                     if (err != PETSC_SUCCESS)
                     {
                         std::cerr << "The setup of the solver failed!" << std::endl;
                         assert(false && "Failed solver setup");
                         exit(EXIT_FAILURE);
                     }
-                    times::timers.stop("solver setup");
 
                     if (after_setup)
                     {
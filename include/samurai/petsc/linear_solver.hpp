@@ -4,6 +4,7 @@
 #include "fv/cell_based_scheme_assembly.hpp"
 #include "fv/flux_based_scheme_assembly.hpp"
 #include "fv/operator_sum_assembly.hpp"
+#include "matrix_free.hpp"
 #ifdef ENABLE_MG
 #include "multigrid/petsc/GeometricMultigrid.hpp"
 #else
@@ -160,20 +161,17 @@ namespace samurai
                 }
                 KSPSetFromOptions(m_ksp);
 
-                assemble_matrix();
-
-                // PetscBool is_symmetric;
-                // MatIsSymmetric(m_A, 0, &is_symmetric);
-
-                KSPSetOperators(m_ksp, m_A, m_A);
+                set_operators();
                 if (after_matrix_assembly)
                 {
                     after_matrix_assembly(m_ksp, pc, m_A);
                 }
 
-                times::timers.start("solver setup");
-                PetscErrorCode err = KSPSetUp(m_ksp);
-                times::timers.stop("solver setup");
+                PetscErrorCode err;
+                {
+                    SAMURAI_PROFILE_REGION("solver setup");
+                    err = KSPSetUp(m_ksp);
+                }
 
                 if (err != PETSC_SUCCESS)
                 {
@@ -191,9 +189,28 @@ namespace samurai
 
           protected:
 
+            /**
+             * Sets the operator and the preconditioning matrix of the KSP.
+             */
+            virtual void set_operators()
+            {
+                assemble_matrix();
+
+                // PetscBool is_symmetric;
+                // MatIsSymmetric(m_A, 0, &is_symmetric);
+
+                KSPSetOperators(m_ksp, m_A, m_A);
+            }
+
             void prepare_rhs_and_solve(Vec& b, Vec& x)
             {
-                times::timers.start("system solve");
+                prepare_rhs(b);
+                solve_system(b, x);
+            }
+
+            void prepare_rhs(Vec& b)
+            {
+                SAMURAI_PROFILE_REGION("rhs preparation");
 
                 assembly().set_0_for_all_ghosts(b);
                 // Update the right-hand side with the boundary conditions stored in the solution field
@@ -208,6 +225,11 @@ namespace samurai
                 // VecView(b, PETSC_VIEWER_STDOUT_WORLD);
                 // std::cout << std::endl;
 
+                remove_null_space(b);
+            }
+
+            void remove_null_space(Vec& b)
+            {
                 MatNullSpace ns = NULL;
                 MatGetNullSpace(m_A, &ns);
                 if (ns)
@@ -215,20 +237,15 @@ namespace samurai
                     /* remove nullspace components from b (in place) so b \in Range(A) */
                     MatNullSpaceRemove(ns, b);
                 }
-
-                times::timers.stop("system solve");
-
-                solve_system(b, x);
             }
 
             void solve_system(Vec& b, Vec& x)
             {
-                times::timers.start("system solve");
-
                 //  Solve the system
-                KSPSolve(m_ksp, b, x);
-
-                times::timers.stop("system solve");
+                {
+                    SAMURAI_PROFILE_REGION("system solve");
+                    KSPSolve(m_ksp, b, x);
+                }
 
                 KSPConvergedReason reason_code;
                 KSPGetConvergedReason(m_ksp, &reason_code);
@@ -294,6 +311,10 @@ namespace samurai
 
           private:
 
+            bool m_matrix_free            = args::petsc_matrix_free;
+            MatrixFreePC m_matrix_free_pc = matrix_free_pc_from_args();
+            MatrixFreeOperator<Assembly<Scheme>> m_matrix_free_operator;
+
             bool m_use_samurai_mg = false;
 #ifdef ENABLE_MG
             GeometricMultigrid<Assembly<Scheme>> _samurai_mg;
@@ -349,6 +370,25 @@ namespace samurai
 #endif
             }
 
+            void set_operators() override
+            {
+                if (!m_matrix_free)
+                {
+                    base_class::set_operators();
+                    return;
+                }
+
+                m_matrix_free_operator.create(assembly(), m_A);
+                if (m_matrix_free_pc == MatrixFreePC::Assembled)
+                {
+                    KSPSetOperators(m_ksp, m_A, m_matrix_free_operator.assemble_preconditioner());
+                }
+                else
+                {
+                    KSPSetOperators(m_ksp, m_A, m_A);
+                }
+            }
+
           public:
 
             void set_unknown(Field& unknown)
@@ -356,6 +396,22 @@ namespace samurai
                 assembly().set_unknown(unknown);
             }
 
+            /**
+             * Applies the scheme to the vectors instead of assembling its matrix (see MatrixFreeOperator).
+             * Default: command line options --petsc-matrix-free and --petsc-matrix-free-pc.
+             */
+            void set_matrix_free(bool matrix_free, MatrixFreePC pc = MatrixFreePC::None)
+            {
+                m_matrix_free    = matrix_free;
+                m_matrix_free_pc = pc;
+                m_is_set_up      = false;
+            }
+
+            bool is_matrix_free() const
+            {
+                return m_matrix_free;
+            }
+
 #ifdef ENABLE_MG
             void setup() override
             {
@@ -383,15 +439,21 @@ namespace samurai
                     KSPSetOperators(m_ksp, m_A, m_A);
                 }
 
-                times::timers.start("solver setup");
-                KSPSetUp(m_ksp);
-                times::timers.stop("solver setup");
+                {
+                    SAMURAI_PROFILE_REGION("solver setup");
+                    KSPSetUp(m_ksp);
+                }
                 m_is_set_up = true;
             }
 #endif
 
             void solve(const Field& rhs)
             {
+                if (m_matrix_free && m_is_set_up && !m_matrix_free_operator.is_context_of(m_A))
+                {
+                    // The solver has been copied or moved: the shell matrix must be created again
+                    m_is_set_up = false;
+                }
                 if (!m_is_set_up)
                 {
                     this->setup();
@@ -402,7 +464,20 @@ namespace samurai
 
                 PetscObjectSetName(reinterpret_cast<PetscObject>(b), "b");
 
-                this->prepare_rhs_and_solve(b, x);
+                if (m_matrix_free)
+                {
+                    // F(0) holds the current values of the boundary conditions
+                    m_matrix_free_operator.set_linear_base();
+                    m_matrix_free_operator.prepare_linear_rhs(b, x);
+                    this->remove_null_space(b);
+                    this->solve_system(b, x);
+                    // The ghosts are not solved: they are recomputed from the cells when needed
+                    assembly().unknown().ghosts_updated() = false;
+                }
+                else
+                {
+                    this->prepare_rhs_and_solve(b, x);
+                }
 
 #ifdef SAMURAI_WITH_MPI
                 assembly().copy_unknown(x, assembly().unknown());
@@ -1,5 +1,6 @@
 #pragma once
-#include "../timers.hpp"
+#include "../memory_tracker.hpp"
+#include "../profiling.hpp"
 #include <petsc.h>
 
 namespace samurai
@@ -21,6 +22,8 @@ namespace samurai
 
             InsertMode m_current_insert_mode = INSERT_VALUES;
 
+            MemoryHandle m_matrix_memory; // entry of the memory tracker of the last assembled matrix
+
           protected:
 
             // ----- For blocks in a monolithic block matrix ----- //
@@ -237,7 +240,7 @@ namespace samurai
              */
             virtual void create_matrix(Mat& A)
             {
-                times::timers.start("matrix assembly");
+                SAMURAI_PROFILE_REGION("matrix preallocation");
 
                 assert(!m_is_block_in_monolithic_matrix);
                 if (!m_is_block_in_nested_matrix && !m_is_set_up)
@@ -344,7 +347,6 @@ namespace samurai
 #endif
                 }
                 // MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
-                times::timers.stop("matrix assembly");
             }
 
             /**
@@ -353,7 +355,7 @@ namespace samurai
              */
             virtual void assemble_matrix(Mat& A, bool final_assembly = true)
             {
-                times::timers.start("matrix assembly");
+                SAMURAI_PROFILE_REGION("matrix assembly");
 
                 assemble_scheme(A);
 
@@ -388,9 +390,17 @@ namespace samurai
                             std::cerr << "Error during MatAssemblyEnd of matrix '" << name() << "'." << std::endl;
                             exit(EXIT_FAILURE);
                         }
+
+                        // Allocated storage of the matrix: values and column indices of the non-zeros, and row offsets
+                        MatInfo info;
+                        MatGetInfo(A, MAT_LOCAL, &info);
+                        PetscInt n_local_rows;
+                        MatGetLocalSize(A, &n_local_rows, nullptr);
+                        auto bytes = static_cast<std::size_t>(info.nz_allocated) * (sizeof(PetscScalar) + sizeof(PetscInt))
+                                   + static_cast<std::size_t>(n_local_rows + 1) * sizeof(PetscInt);
+                        m_matrix_memory.update("PETSc", name(), bytes);
                     }
                 }
-                times::timers.stop("matrix assembly");
             }
 
             virtual ~MatrixAssembly()
@@ -0,0 +1,270 @@
+#pragma once
+#include "../arguments.hpp"
+#include "../profiling.hpp"
+#include <cmath>
+#include <petsc.h>
+
+namespace samurai
+{
+    namespace petsc
+    {
+        /**
+         * Preconditioning matrix of a matrix-free solver.
+         */
+        enum class MatrixFreePC
+        {
+            None,     // no matrix is assembled: the preconditioner is chosen by PETSc (none by default) or set by the user in 'configure'
+            Assembled // the matrix of the scheme is assembled once per solve, and only used to build the preconditioner
+        };
+
+        inline MatrixFreePC matrix_free_pc_from_args()
+        {
+            return args::petsc_matrix_free_pc == "assembled" ? MatrixFreePC::Assembled : MatrixFreePC::None;
+        }
+
+        /**
+         * Matrix-free operator of an implicit scheme, as a PETSc MATSHELL.
+         *
+         * The product by a vector v applies the scheme to worker fields, in the same way as its explicit application:
+         *
+         *      J v = (F(x0 + h v) - F(x0)) / h,
+         *
+         * where F is the scheme (including the boundary conditions and the projection/prediction of the ghosts, which are recomputed
+         * from the cell values), and x0 is the linearization point. For linear schemes, x0 = 0 and h = 1, so that the product is exact.
+         * The ghost values being recomputed by the scheme, the rows of the ghosts are replaced by the identity.
+         */
+        template <class Assembly>
+        class MatrixFreeOperator
+        {
+            using scheme_t       = typename Assembly::scheme_t;
+            using input_field_t  = typename scheme_t::input_field_t;
+            using output_field_t = typename scheme_t::output_field_t;
+
+            Assembly* m_assembly = nullptr;
+            Mat m_P              = nullptr; // optional preconditioning matrix
+
+            input_field_t m_input;   // worker field for the vector to which the scheme is applied
+            output_field_t m_output; // worker field for the result of the scheme
+
+            Vec m_x0         = nullptr; // linearization point
+            Vec m_f0         = nullptr; // F(x0)
+            Vec m_work       = nullptr;
+            Vec m_cells_mask = nullptr; // 1 for the rows of the cells, 0 for the rows of the ghosts
+            bool m_linear    = true;
+
+          public:
+
+            MatrixFreeOperator() = default;
+
+            // The PETSc objects are not shared: they are created again by create()
+            MatrixFreeOperator(const MatrixFreeOperator&)
+            {
+            }
+
+            MatrixFreeOperator& operator=(const MatrixFreeOperator& other)
+            {
+                if (this != &other)
+                {
+                    destroy_petsc_objects();
+                }
+                return *this;
+            }
+
+            ~MatrixFreeOperator()
+            {
+                destroy_petsc_objects();
+            }
+
+            void destroy_petsc_objects()
+            {
+                if (m_P)
+                {
+                    m_assembly->destroy_local_to_global_mappings(m_P);
+                    MatDestroy(&m_P);
+                }
+                VecDestroy(&m_x0);
+                VecDestroy(&m_f0);
+                VecDestroy(&m_work);
+                VecDestroy(&m_cells_mask);
+            }
+
+            /**
+             * Creates the shell matrix A applying the scheme of the assembly, which must outlive this object.
+             */
+            void create(Assembly& assembly, Mat& A)
+            {
+                destroy_petsc_objects();
+                if (A)
+                {
+                    MatDestroy(&A);
+                }
+
+                m_assembly = &assembly;
+                if (!m_assembly->is_set_up())
+                {
+                    m_assembly->setup();
+                    m_assembly->is_set_up(true);
+                }
+
+                m_input  = m_assembly->unknown(); // copies the boundary conditions
+                m_output = output_field_t("matrix-free output", m_input.mesh());
+
+                MatCreateShell(PETSC_COMM_WORLD,
+                               m_assembly->owned_matrix_rows(),
+                               m_assembly->owned_matrix_cols(),
+                               PETSC_DETERMINE,
+                               PETSC_DETERMINE,
+                               this,
+                               &A);
+                MatShellSetOperation(A, MATOP_MULT, reinterpret_cast<void (*)(void)>(PETSC_mult));
+                PetscObjectSetName(reinterpret_cast<PetscObject>(A), m_assembly->name().c_str());
+
+                MatCreateVecs(A, &m_x0, &m_f0);
+                VecDuplicate(m_f0, &m_work);
+                VecDuplicate(m_f0, &m_cells_mask);
+                VecSet(m_cells_mask, 1);
+                m_assembly->set_0_for_all_ghosts(m_cells_mask);
+            }
+
+            /**
+             * Linearization at x0 = 0 for a linear scheme: F(0) holds the contributions of the boundary conditions.
+             * It must be computed again at each solve, the boundary conditions of the unknown being able to change between two solves.
+             */
+            void set_linear_base()
+            {
+                m_linear = true;
+                update_bc();
+                VecSet(m_x0, 0);
+                apply_scheme(m_x0, m_f0);
+            }
+
+            /**
+             * Linearization at x0 for a non-linear scheme (Jacobian-free Newton-Krylov).
+             */
+            void set_base(Vec x0)
+            {
+                m_linear = false;
+                update_bc();
+                VecCopy(x0, m_x0);
+                apply_scheme(m_x0, m_f0);
+            }
+
+            /**
+             * Whether A is the shell matrix created by this operator. After a copy or a move of the solver owning A,
+             * the context of A is still the operator of the other solver.
+             */
+            bool is_context_of(Mat A) const
+            {
+                if (!A)
+                {
+                    return false;
+                }
+                MatrixFreeOperator* context = nullptr;
+                MatShellGetContext(A, &context);
+                return context == this;
+            }
+
+            /**
+             * Right-hand side of the linear system solved in matrix-free mode: b - F(0) for the cells,
+             * and the initial guess x for the ghosts, so that the ghost equations are already satisfied.
+             */
+            void prepare_linear_rhs(Vec& b, const Vec& x)
+            {
+                SAMURAI_PROFILE_REGION("rhs preparation");
+
+                VecAXPY(b, -1, m_f0);
+                keep_ghost_rows(x, b);
+            }
+
+            /**
+             * Assembles the matrix of the scheme in the preconditioning matrix (allocated at the first call).
+             */
+            Mat& assemble_preconditioner()
+            {
+                if (m_P)
+                {
+                    MatZeroEntries(m_P);
+                }
+                else
+                {
+                    m_assembly->create_matrix(m_P);
+                }
+                m_assembly->assemble_matrix(m_P);
+                PetscObjectSetName(reinterpret_cast<PetscObject>(m_P), "P");
+                return m_P;
+            }
+
+            Mat& preconditioner()
+            {
+                return m_P;
+            }
+
+          private:
+
+            // The boundary conditions of the unknown may have been replaced since the creation of the worker field
+            void update_bc()
+            {
+                m_input.get_bc().clear();
+                m_input.copy_bc_from(m_assembly->unknown());
+            }
+
+            // f = F(x)
+            void apply_scheme(const Vec& x, Vec& f)
+            {
+                m_assembly->copy_unknown(x, m_input);
+                m_output.fill(0);
+                m_assembly->scheme().apply(m_output, m_input);
+                m_assembly->copy_rhs(m_output, f);
+            }
+
+            // y = y for the rows of the cells, v for the rows of the ghosts
+            void keep_ghost_rows(const Vec& v, Vec& y)
+            {
+                VecPointwiseMult(y, y, m_cells_mask);
+                VecPointwiseMult(m_work, v, m_cells_mask);
+                VecAYPX(m_work, -1, v);
+                VecAXPY(y, 1, m_work);
+            }
+
+            void mult(Vec v, Vec y)
+            {
+                if (m_linear)
+                {
+                    apply_scheme(v, y);
+                    VecAXPY(y, -1, m_f0);
+                }
+                else
+                {
+                    PetscReal norm_v;
+                    VecNorm(v, NORM_2, &norm_v);
+                    if (norm_v == 0)
+                    {
+                        VecSet(y, 0);
+                        return;
+                    }
+                    PetscReal norm_x0;
+                    VecNorm(m_x0, NORM_2, &norm_x0);
+                    // Differencing parameter of Walker and Pernice (same as the default of PETSc's MATMFFD)
+                    PetscReal h = PETSC_SQRT_MACHINE_EPSILON * std::sqrt(1 + norm_x0) / norm_v;
+
+                    VecWAXPY(m_work, h, v, m_x0);
+                    apply_scheme(m_work, y);
+                    VecAXPY(y, -1, m_f0);
+                    VecScale(y, 1 / h);
+                }
+                keep_ghost_rows(v, y);
+            }
+
+            static PetscErrorCode PETSC_mult(Mat A, Vec v, Vec y)
+            {
+                SAMURAI_PROFILE_REGION("matrix-free product");
+
+                MatrixFreeOperator* self;
+                MatShellGetContext(A, &self);
+                self->mult(v, y);
+                return PETSC_SUCCESS;
+            }
+        };
+
+    } // end namespace petsc
+} // end namespace samurai
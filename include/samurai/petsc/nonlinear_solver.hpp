@@ -2,6 +2,7 @@
 #include "fv/cell_based_scheme_assembly.hpp"
 #include "fv/flux_based_scheme_assembly.hpp"
 #include "fv/operator_sum_assembly.hpp"
+#include "matrix_free.hpp"
 #include "utils.hpp"
 #include <petsc.h>
 
@@ -25,6 +26,11 @@ namespace samurai
 
             output_field_t m_worker_output_field;
 
+            bool m_matrix_free                 = args::petsc_matrix_free;
+            MatrixFreePC m_matrix_free_pc      = matrix_free_pc_from_args();
+            bool m_preconditioner_is_assembled = false;
+            MatrixFreeOperator<Assembly> m_matrix_free_operator;
+
           public:
 
             // User callback to configure the solver
@@ -141,14 +147,30 @@ namespace samurai
                 // Non-linear function
                 SNESSetFunction(m_snes, nullptr, PETSC_nonlinear_function, this);
 
-                // Jacobian matrix
-                if (!m_reuse_allocated_matrix)
+                // Jacobian matrix and function
+                if (m_matrix_free)
                 {
-                    assembly().create_matrix(m_J);
+                    m_matrix_free_operator.create(assembly(), m_J);
+                    m_reuse_allocated_matrix = false;
+                    if (m_matrix_free_pc == MatrixFreePC::Assembled)
+                    {
+                        // The preconditioner is built at the first Newton iteration of each solve only (see solve_system())
+                        assembly().create_matrix(m_matrix_free_operator.preconditioner());
+                        SNESSetJacobian(m_snes, m_J, m_matrix_free_operator.preconditioner(), PETSC_jacobian_function, this);
+                    }
+                    else
+                    {
+                        SNESSetJacobian(m_snes, m_J, m_J, PETSC_jacobian_function, this);
+                    }
+                }
+                else
+                {
+                    if (!m_reuse_allocated_matrix)
+                    {
+                        assembly().create_matrix(m_J);
+                    }
+                    SNESSetJacobian(m_snes, m_J, m_J, PETSC_jacobian_function, this);
                 }
-
-                // Jacobian function
-                SNESSetJacobian(m_snes, m_J, m_J, PETSC_jacobian_function, this);
 
                 KSP ksp;
                 PC pc;
@@ -167,7 +189,7 @@ namespace samurai
 
             static PetscErrorCode PETSC_nonlinear_function(SNES /*snes*/, Vec x, Vec f, void* ctx)
             {
-                times::timers.stop("nonlinear system solve");
+                SAMURAI_PROFILE_REGION("nonlinear function");
 
                 auto self      = reinterpret_cast<NonLinearSolverBase*>(ctx); // this
                 auto& assembly = self->assembly();
@@ -189,19 +211,35 @@ namespace samurai
                 // Set to zero the right-hand side of the ghost equations and apply BCs attached to the unknown field
                 self->prepare_rhs(f);
 
-                times::timers.start("nonlinear system solve");
                 return PETSC_SUCCESS;
             }
 
             static PetscErrorCode PETSC_jacobian_function(SNES /*snes*/, Vec x, Mat jac, Mat B, void* ctx)
             {
-                times::timers.stop("nonlinear system solve");
+                SAMURAI_PROFILE_REGION("jacobian function");
 
                 // Here, jac = B = this.m_J
 
                 auto self      = reinterpret_cast<NonLinearSolverBase*>(ctx); // this
                 auto& assembly = self->assembly();
 
+                if (self->m_matrix_free)
+                {
+                    // jac is the shell matrix: only its linearization point changes.
+                    // F(x) is evaluated again on the worker fields, because SNES only stores F(x) - rhs.
+                    self->m_matrix_free_operator.set_base(x);
+                    if (B != jac && !self->m_preconditioner_is_assembled)
+                    {
+                        assembly.copy_unknown(x, assembly.unknown());
+                        MatZeroEntries(B);
+                        assembly.assemble_matrix(B);
+                        self->m_preconditioner_is_assembled = true;
+                    }
+                    MatAssemblyBegin(jac, MAT_FINAL_ASSEMBLY);
+                    MatAssemblyEnd(jac, MAT_FINAL_ASSEMBLY);
+                    return PETSC_SUCCESS;
+                }
+
                 // Ideally, we would like to wrap a field structure around the data of the Petsc vector x,
                 // but we don't have such a Field constructor.
                 // So, instead, we reuse the unknown field and copy the data.
@@ -221,7 +259,6 @@ namespace samurai
                 // MatView(B, PETSC_VIEWER_STDOUT_(PETSC_COMM_WORLD));
                 // std::cout << std::endl;
 
-                times::timers.start("nonlinear system solve");
                 return PETSC_SUCCESS;
             }
 
@@ -250,10 +287,18 @@ namespace samurai
 
             void solve_system(Vec& b, Vec& x)
             {
+                if (m_matrix_free && m_matrix_free_pc == MatrixFreePC::Assembled)
+                {
+                    // -2: the preconditioner is rebuilt at the next Newton iteration, then lagged until the end of the solve
+                    m_preconditioner_is_assembled = false;
+                    SNESSetLagPreconditioner(m_snes, -2);
+                }
+
                 // Solve the system
-                times::timers.start("nonlinear system solve");
-                SNESSolve(m_snes, b, x);
-                times::timers.stop("nonlinear system solve");
+                {
+                    SAMURAI_PROFILE_REGION("nonlinear system solve");
+                    SNESSolve(m_snes, b, x);
+                }
 
                 SNESConvergedReason reason_code;
                 SNESGetConvergedReason(m_snes, &reason_code);
@@ -270,10 +315,33 @@ namespace samurai
                     exit(EXIT_FAILURE);
                 }
                 // VecView(x, PETSC_VIEWER_STDOUT_(PETSC_COMM_WORLD)); std::cout << std::endl;
+
+                if (m_matrix_free)
+                {
+                    // The ghosts are not solved: they are recomputed from the cells when needed
+                    assembly().unknown().ghosts_updated() = false;
+                }
             }
 
           public:
 
+            /**
+             * Jacobian-free Newton-Krylov: the products by the Jacobian matrix are computed by differencing the application of the scheme
+             * instead of assembling the Jacobian matrix (see MatrixFreeOperator).
+             * Default: command line options --petsc-matrix-free and --petsc-matrix-free-pc.
+             */
+            void set_matrix_free(bool matrix_free, MatrixFreePC pc = MatrixFreePC::None)
+            {
+                m_matrix_free    = matrix_free;
+                m_matrix_free_pc = pc;
+                m_is_set_up      = false;
+            }
+
+            bool is_matrix_free() const
+            {
+                return m_matrix_free;
+            }
+
             int iterations()
             {
                 PetscInt n_iterations;
@@ -319,6 +387,8 @@ namespace samurai
             using base_class::assembly;
             using base_class::m_is_set_up;
             using base_class::m_J;
+            using base_class::m_matrix_free;
+            using base_class::m_matrix_free_operator;
             using base_class::m_worker_output_field;
 
             explicit NonLinearSolver(const scheme_t& scheme)
@@ -335,6 +405,11 @@ namespace samurai
             {
                 m_worker_output_field = output_field_t("worker_output", rhs.mesh());
 
+                if (m_matrix_free && m_is_set_up && !m_matrix_free_operator.is_context_of(m_J))
+                {
+                    // The solver has been copied or moved: the shell matrix must be created again
+                    m_is_set_up = false;
+                }
                 if (!m_is_set_up)
                 {
                     this->setup();
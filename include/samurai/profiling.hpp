@@ -0,0 +1,806 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/color.h>
+#include <fmt/format.h>
+
+#include "assert_log_trace.hpp"
+#include "perf_counters.hpp"
+
+#ifdef SAMURAI_WITH_MPI
+#include <boost/mpi.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+#endif
+
+/**
+ * Profiling regions.
+ *
+ * A region is a named scope of the code, identified by an integer id which is computed once for each call site.
+ * The regions opened by a thread form a tree: a region opened while another one is running is stored as its child,
+ * so that the time spent e.g. in the ghost update is reported separately for the mesh adaptation and for the schemes.
+ * Each thread accumulates the time in its own tree, without any synchronization.
+ * When requested, the begin and end times of each region are also recorded, and saved in the Chrome trace format,
+ * which can be read by chrome://tracing or https://ui.perfetto.dev.
+ * With SAMURAI_WITH_PERF_COUNTERS, the hardware counters of the thread (see perf_counters.hpp) are also accumulated in each region,
+ * with the number of bytes of the fields touched by the region (add_field_bytes), to report the achieved bandwidth.
+ *
+ * Usage:
+ *
+ *     void my_function()
+ *     {
+ *         SAMURAI_PROFILE_REGION("my function");
+ *         ...
+ *     }
+ */
+namespace samurai::profiling
+{
+    using region_id_t = std::uint32_t;
+    using clock_type  = std::chrono::steady_clock;
+
+    /**
+     * Accumulated time of a region, for a given path in the tree of a thread.
+     */
+    struct RegionNode
+    {
+        region_id_t region;
+        std::size_t parent;
+        std::vector<std::size_t> children = {};
+        std::int64_t elapsed              = 0; // in nanoseconds
+        std::size_t calls                 = 0;
+        CounterValues counters            = {};
+        std::uint64_t bytes               = 0; // estimate of the memory traffic
+    };
+
+    /**
+     * Execution of a region, recorded for the trace.
+     */
+    struct TraceEvent
+    {
+        region_id_t region;
+        std::int64_t begin; // in nanoseconds since the creation of the profiler
+        std::int64_t end;
+    };
+
+    /**
+     * Summary of a node of the tree of regions, used to print the report.
+     */
+    struct RegionSummary
+    {
+        std::size_t thread;
+        std::size_t depth; // 0 for the regions opened outside of any other region
+        std::string name;
+        std::string path;  // names of the enclosing regions and of the region, separated by '/'
+        double elapsed;    // in seconds
+        double self;       // elapsed time minus the elapsed time of the children
+        std::size_t calls;
+        CounterValues counters;
+        std::uint64_t bytes;
+    };
+
+    /**
+     * Tree of the regions opened by a thread.
+     */
+    class ThreadProfile
+    {
+      public:
+
+        static constexpr std::size_t root = 0;
+
+        ThreadProfile(std::size_t index, clock_type::time_point epoch, const std::atomic<bool>& trace)
+            : m_index(index)
+            , m_epoch(epoch)
+            , m_trace(trace)
+        {
+            clear();
+        }
+
+        void enter(region_id_t region)
+        {
+            std::size_t child = root;
+            for (auto c : m_nodes[m_current].children)
+            {
+                if (m_nodes[c].region == region)
+                {
+                    child = c;
+                    break;
+                }
+            }
+            if (child == root)
+            {
+                child = m_nodes.size();
+                m_nodes.push_back({region, m_current});
+                m_nodes[m_current].children.push_back(child);
+            }
+            m_current = child;
+            if constexpr (PerfCounters::enabled)
+            {
+                m_counter_starts.push_back(m_counters.read());
+            }
+            m_starts.push_back(now());
+        }
+
+        void exit()
+        {
+            SAMURAI_ASSERT(m_current != root, "[ThreadProfile::exit] No region is running");
+            close_current(true);
+        }
+
+        /**
+         * Closes the innermost running execution of the region, which is not necessarily the innermost running region.
+         * The regions opened inside it are closed and reopened in its parent: their elapsed time is then split
+         * between two nodes of the tree, but their call is counted once.
+         */
+        void exit(region_id_t region)
+        {
+            std::vector<region_id_t> interrupted;
+            while (m_current != root && m_nodes[m_current].region != region)
+            {
+                interrupted.push_back(m_nodes[m_current].region);
+                close_current(false);
+            }
+            SAMURAI_ASSERT(m_current != root, "[ThreadProfile::exit] The region is not running");
+            close_current(true);
+            for (auto it = interrupted.rbegin(); it != interrupted.rend(); ++it)
+            {
+                enter(*it);
+            }
+        }
+
+        /**
+         * Adds the bytes to the memory traffic of the innermost running region.
+         */
+        void add_bytes(std::uint64_t bytes)
+        {
+            m_nodes[m_current].bytes += bytes;
+        }
+
+        bool counters_available() const
+        {
+            return m_counters.available();
+        }
+
+        /**
+         * Id of the innermost running region, or max() if no region is running.
+         */
+        region_id_t current_region() const
+        {
+            return m_current == root ? std::numeric_limits<region_id_t>::max() : m_nodes[m_current].region;
+        }
+
+        void clear()
+        {
+            SAMURAI_ASSERT(m_starts.empty(), "[ThreadProfile::clear] The profile cannot be cleared while a region is running");
+            m_nodes.clear();
+            m_nodes.push_back({std::numeric_limits<region_id_t>::max(), root});
+            m_current = root;
+            m_events.clear();
+        }
+
+        std::size_t index() const
+        {
+            return m_index;
+        }
+
+        const auto& nodes() const
+        {
+            return m_nodes;
+        }
+
+        const auto& events() const
+        {
+            return m_events;
+        }
+
+      private:
+
+        std::int64_t now() const
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - m_epoch).count();
+        }
+
+        void close_current(bool count_call)
+        {
+            auto end = now();
+
+            auto begin = m_starts.back();
+            m_starts.pop_back();
+
+            auto& node = m_nodes[m_current];
+            node.elapsed += end - begin;
+            if (count_call)
+            {
+                ++node.calls;
+            }
+            if constexpr (PerfCounters::enabled)
+            {
+                node.counters += m_counters.read() - m_counter_starts.back();
+                m_counter_starts.pop_back();
+            }
+            if (m_trace.load(std::memory_order_relaxed))
+            {
+                m_events.push_back({node.region, begin, end});
+            }
+            m_current = node.parent;
+        }
+
+        std::size_t m_index;
+        clock_type::time_point m_epoch;
+        const std::atomic<bool>& m_trace;
+
+        std::vector<RegionNode> m_nodes;
+        std::size_t m_current = root;
+        std::vector<std::int64_t> m_starts;
+        std::vector<TraceEvent> m_events;
+
+        PerfCounters m_counters;
+        std::vector<CounterValues> m_counter_starts;
+    };
+
+    /**
+     * Registry of the region names and of the thread profiles.
+     *
+     * The reports (summary, print, save_trace) read the profiles of all the threads:
+     * they must be called while the other threads do not open any region.
+     */
+    class Profiler
+    {
+      public:
+
+        Profiler()
+            : m_epoch(clock_type::now())
+        {
+        }
+
+        Profiler(const Profiler&)            = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        /**
+         * Returns the id of the region of the given name, which is created at the first call.
+         */
+        region_id_t register_region(std::string_view name)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto [it, inserted] = m_ids.try_emplace(std::string(name), static_cast<region_id_t>(m_names.size()));
+            if (inserted)
+            {
+                m_names.push_back(it->first);
+            }
+            return it->second;
+        }
+
+        std::string region_name(region_id_t region) const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_names[region];
+        }
+
+        ThreadProfile& register_thread()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_threads.push_back(std::make_unique<ThreadProfile>(m_threads.size(), m_epoch, m_trace));
+            return *m_threads.back();
+        }
+
+        std::size_t nb_threads() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_threads.size();
+        }
+
+        void enable_trace(bool enable = true)
+        {
+            m_trace.store(enable, std::memory_order_relaxed);
+        }
+
+        bool trace_enabled() const
+        {
+            return m_trace.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Clears the accumulated times and the recorded events of all the threads.
+         */
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& thread : m_threads)
+            {
+                thread->clear();
+            }
+        }
+
+        /**
+         * Nodes of the trees of all the threads, in depth-first order.
+         */
+        std::vector<RegionSummary> summary() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::vector<RegionSummary> result;
+            for (const auto& thread : m_threads)
+            {
+                const auto& nodes = thread->nodes();
+                for (auto child : nodes[ThreadProfile::root].children)
+                {
+                    collect(*thread, child, 0, "", result);
+                }
+            }
+            return result;
+        }
+
+        bool counters_available() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& thread : m_threads)
+            {
+                if (thread->counters_available())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void print() const;
+
+        /**
+         * Prints the hardware counters and the bandwidth of the regions of the current process.
+         */
+        void print_counters() const;
+
+        /**
+         * Saves the recorded events in the Chrome trace format.
+         * With MPI, each rank saves its own file, suffixed by the rank.
+         */
+        void save_trace(const std::filesystem::path& filename) const;
+
+      private:
+
+        void collect(const ThreadProfile& thread,
+                     std::size_t n,
+                     std::size_t depth,
+                     const std::string& parent_path,
+                     std::vector<RegionSummary>& result) const
+        {
+            const auto& node = thread.nodes()[n];
+            auto path        = depth == 0 ? m_names[node.region] : parent_path + "/" + m_names[node.region];
+
+            std::int64_t children_elapsed = 0;
+            for (auto child : node.children)
+            {
+                children_elapsed += thread.nodes()[child].elapsed;
+            }
+            result.push_back({thread.index(),
+                              depth,
+                              m_names[node.region],
+                              path,
+                              1e-9 * static_cast<double>(node.elapsed),
+                              1e-9 * static_cast<double>(node.elapsed - children_elapsed),
+                              node.calls,
+                              node.counters,
+                              node.bytes});
+
+            for (auto child : node.children)
+            {
+                collect(thread, child, depth + 1, path, result);
+            }
+        }
+
+        static std::string escape(const std::string& s)
+        {
+            std::string result;
+            for (char c : s)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    result += '\\';
+                }
+                result += c;
+            }
+            return result;
+        }
+
+        clock_type::time_point m_epoch;
+        std::atomic<bool> m_trace = false;
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<std::string, region_id_t> m_ids;
+        std::deque<std::string> m_names;
+        std::vector<std::unique_ptr<ThreadProfile>> m_threads;
+    };
+
+    inline Profiler& profiler()
+    {
+        static Profiler instance;
+        return instance;
+    }
+
+    inline ThreadProfile& this_thread_profile()
+    {
+        thread_local ThreadProfile& profile = profiler().register_thread();
+        return profile;
+    }
+
+    inline region_id_t register_region(std::string_view name)
+    {
+        return profiler().register_region(name);
+    }
+
+    /**
+     * Adds the bytes to the memory traffic of the innermost running region of the current thread.
+     * Does nothing without SAMURAI_WITH_PERF_COUNTERS.
+     */
+    inline void add_bytes([[maybe_unused]] std::uint64_t bytes)
+    {
+        if constexpr (PerfCounters::enabled)
+        {
+            this_thread_profile().add_bytes(bytes);
+        }
+    }
+
+    /**
+     * Adds the size of the data of the fields to the memory traffic of the innermost running region.
+     * This is an estimate of the bytes moved by a kernel which reads or writes each field once.
+     */
+    template <class... Fields>
+    void add_field_bytes([[maybe_unused]] const Fields&... fields)
+    {
+        if constexpr (PerfCounters::enabled)
+        {
+            add_bytes((std::uint64_t{0} + ... + static_cast<std::uint64_t>(fields.array().size() * sizeof(typename Fields::value_type))));
+        }
+    }
+
+    /**
+     * Adds the size of the ghost values of the fields to the memory traffic of the innermost running region.
+     * The ghosts are the cells of the reference mesh which are not cells of the mesh: a ghost update computes
+     * or receives each of them once, while the cells are only read.
+     */
+    template <class... Fields>
+    void add_ghost_bytes([[maybe_unused]] const Fields&... fields)
+    {
+        if constexpr (PerfCounters::enabled)
+        {
+            auto ghost_bytes = [](const auto& field)
+            {
+                using field_t   = std::decay_t<decltype(field)>;
+                using mesh_id_t = typename field_t::mesh_t::mesh_id_t;
+
+                const auto& mesh = field.mesh();
+                auto nb_ghosts   = mesh[mesh_id_t::reference].nb_cells() - mesh[mesh_id_t::cells].nb_cells();
+                return static_cast<std::uint64_t>(nb_ghosts * field_t::n_comp * sizeof(typename field_t::value_type));
+            };
+            add_bytes((std::uint64_t{0} + ... + ghost_bytes(fields)));
+        }
+    }
+
+    /**
+     * Runs the region in the current thread during its lifetime.
+     */
+    class ScopedRegion
+    {
+      public:
+
+        explicit ScopedRegion(region_id_t region)
+            : m_profile(this_thread_profile())
+        {
+            m_profile.enter(region);
+        }
+
+        ~ScopedRegion()
+        {
+            m_profile.exit();
+        }
+
+        ScopedRegion(const ScopedRegion&)            = delete;
+        ScopedRegion& operator=(const ScopedRegion&) = delete;
+
+      private:
+
+        ThreadProfile& m_profile;
+    };
+
+#ifdef SAMURAI_WITH_MPI
+    inline void Profiler::print() const
+    {
+        boost::mpi::communicator world;
+
+        // Only the regions of the rank 0 are printed: the times of the other ranks are looked up by path.
+        auto regions = summary();
+        std::vector<std::pair<std::string, double>> times;
+        times.reserve(regions.size());
+        for (const auto& r : regions)
+        {
+            times.emplace_back(fmt::format("{}:{}", r.thread, r.path), r.elapsed);
+        }
+        std::vector<std::vector<std::pair<std::string, double>>> all_times;
+        boost::mpi::gather(world, times, all_times, 0);
+
+        if (world.rank() != 0)
+        {
+            return;
+        }
+
+        std::vector<std::unordered_map<std::string, double>> times_by_rank(all_times.size());
+        for (std::size_t rank = 0; rank < all_times.size(); ++rank)
+        {
+            times_by_rank[rank].insert(all_times[rank].begin(), all_times[rank].end());
+        }
+
+        std::size_t name_width = 24;
+        for (const auto& r : regions)
+        {
+            name_width = std::max(name_width, 2 * r.depth + r.name.size() + 2);
+        }
+        const int nameWidth  = static_cast<int>(name_width);
+        const int timeWidth  = 16;
+        const int rankWidth  = 7;
+        const int callsWidth = 10;
+
+        fmt::print("\n > [Master] Timers \n");
+        fmt::print(" {:<{}}{:>{}}{:>{}}{:>{}}{:>{}}{:>{}}{:>{}}\n",
+                   "Name",
+                   nameWidth,
+                   "Min time (s)",
+                   timeWidth,
+                   "[r]",
+                   rankWidth,
+                   "Max time (s)",
+                   timeWidth,
+                   "[r]",
+                   rankWidth,
+                   "Ave time (s)",
+                   timeWidth,
+                   "Calls",
+                   callsWidth);
+
+        std::size_t thread = std::numeric_limits<std::size_t>::max();
+        for (const auto& r : regions)
+        {
+            if (r.thread != thread && r.thread != 0)
+            {
+                fmt::print(" > thread {}\n", r.thread);
+            }
+            thread = r.thread;
+
+            auto key    = fmt::format("{}:{}", r.thread, r.path);
+            int minrank = -1, maxrank = -1;
+            double min = std::numeric_limits<double>::max(), max = std::numeric_limits<double>::lowest();
+            double ave        = 0.;
+            std::size_t count = 0;
+            for (std::size_t rank = 0; rank < times_by_rank.size(); ++rank)
+            {
+                auto it = times_by_rank[rank].find(key);
+                if (it == times_by_rank[rank].end())
+                {
+                    continue;
+                }
+                if (it->second < min)
+                {
+                    min     = it->second;
+                    minrank = static_cast<int>(rank);
+                }
+                if (it->second > max)
+                {
+                    max     = it->second;
+                    maxrank = static_cast<int>(rank);
+                }
+                ave += it->second;
+                ++count;
+            }
+            ave /= static_cast<double>(count);
+
+            fmt::print(" {:<{}}{:>{}.5f}{:>{}}{:>{}.5f}{:>{}}{:>{}.5f}{:>{}}\n",
+                       std::string(2 * r.depth, ' ') + r.name,
+                       nameWidth,
+                       min,
+                       timeWidth,
+                       fmt::format("[{}]", minrank),
+                       rankWidth,
+                       max,
+                       timeWidth,
+                       fmt::format("[{}]", maxrank),
+                       rankWidth,
+                       ave,
+                       timeWidth,
+                       r.calls,
+                       callsWidth);
+        }
+
+        if constexpr (PerfCounters::enabled)
+        {
+            print_counters();
+        }
+    }
+#else
+    inline void Profiler::print() const
+    {
+        auto regions = summary();
+
+        std::size_t name_width = 20;
+        for (const auto& r : regions)
+        {
+            name_width = std::max(name_width, 2 * r.depth + r.name.size() + 2);
+        }
+        const int nameWidth = static_cast<int>(name_width);
+
+        // The fractions are relative to the time spent in the top-level regions of the thread
+        std::vector<double> total(nb_threads(), 0.);
+        for (const auto& r : regions)
+        {
+            if (r.depth == 0)
+            {
+                total[r.thread] += r.elapsed;
+            }
+        }
+
+        fmt::print("{:<{}} {:>12} {:>12} {:>12} {:>10}\n", " ", nameWidth, "Elapsed (s)", "Self (s)", "Fraction (%)", "Calls");
+
+        std::size_t thread = std::numeric_limits<std::size_t>::max();
+        for (const auto& r : regions)
+        {
+            if (r.thread != thread && r.thread != 0)
+            {
+                fmt::print(fmt::emphasis::bold, "thread {}", r.thread);
+                fmt::print("\n");
+            }
+            thread = r.thread;
+
+            double fraction = total[r.thread] > 0 ? 100. * r.elapsed / total[r.thread] : 0.;
+            auto name       = std::string(2 * r.depth, ' ') + r.name;
+
+            auto line = fmt::format("{:<{}} {:>12.3f} {:>12.3f} {:>12.1f} {:>10}", name, nameWidth, r.elapsed, r.self, fraction, r.calls);
+            if (r.depth == 0)
+            {
+                fmt::print(fmt::emphasis::bold, "{}", line);
+            }
+            else
+            {
+                fmt::print("{}", line);
+            }
+            fmt::print("\n");
+        }
+        fmt::print("\n");
+
+        if constexpr (PerfCounters::enabled)
+        {
+            print_counters();
+        }
+    }
+#endif
+
+    inline void Profiler::print_counters() const
+    {
+        auto regions = summary();
+
+        std::size_t name_width = 20;
+        for (const auto& r : regions)
+        {
+            name_width = std::max(name_width, 2 * r.depth + r.name.size() + 2);
+        }
+        const int nameWidth = static_cast<int>(name_width);
+
+        if (counters_available())
+        {
+            fmt::print("\n > Hardware counters\n");
+        }
+        else
+        {
+            fmt::print("\n > Hardware counters not available (requires a hardware PMU and /proc/sys/kernel/perf_event_paranoid <= 2)\n");
+        }
+        fmt::print("{:<{}} {:>14} {:>14} {:>8} {:>14} {:>12} {:>10}\n",
+                   " ",
+                   nameWidth,
+                   "Cycles",
+                   "Instructions",
+                   "IPC",
+                   "LLC misses",
+                   "Bytes (MB)",
+                   "GB/s");
+
+        std::size_t thread = std::numeric_limits<std::size_t>::max();
+        for (const auto& r : regions)
+        {
+            if (r.thread != thread && r.thread != 0)
+            {
+                fmt::print("thread {}\n", r.thread);
+            }
+            thread = r.thread;
+
+            std::string ipc       = "-";
+            std::string bandwidth = "-";
+            if (r.counters.cycles > 0)
+            {
+                ipc = fmt::format("{:.2f}", static_cast<double>(r.counters.instructions) / static_cast<double>(r.counters.cycles));
+            }
+            if (r.bytes > 0 && r.elapsed > 0)
+            {
+                bandwidth = fmt::format("{:.2f}", 1e-9 * static_cast<double>(r.bytes) / r.elapsed);
+            }
+            fmt::print("{:<{}} {:>14} {:>14} {:>8} {:>14} {:>12.1f} {:>10}\n",
+                       std::string(2 * r.depth, ' ') + r.name,
+                       nameWidth,
+                       r.counters.cycles,
+                       r.counters.instructions,
+                       ipc,
+                       r.counters.llc_misses,
+                       1e-6 * static_cast<double>(r.bytes),
+                       bandwidth);
+        }
+        fmt::print("\n");
+    }
+
+    inline void Profiler::save_trace(const std::filesystem::path& filename) const
+    {
+        int rank = 0;
+        auto path = filename;
+#ifdef SAMURAI_WITH_MPI
+        boost::mpi::communicator world;
+        rank = world.rank();
+        if (world.size() > 1)
+        {
+            path.replace_filename(fmt::format("{}_rank{}{}", filename.stem().string(), rank, filename.extension().string()));
+        }
+#endif
+        std::ofstream out(path);
+        SAMURAI_ASSERT(out.good(), "[Profiler::save_trace] Cannot open '" + path.string() + "'");
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+        out << fmt::format(R"(  {{"name": "process_name", "ph": "M", "pid": {}, "args": {{"name": "samurai rank {}"}}}})", rank, rank);
+        for (const auto& thread : m_threads)
+        {
+            out << fmt::format(R"(,
+  {{"name": "thread_name", "ph": "M", "pid": {}, "tid": {}, "args": {{"name": "thread {}"}}}})",
+                               rank,
+                               thread->index(),
+                               thread->index());
+            for (const auto& event : thread->events())
+            {
+                // The timestamps are in microseconds
+                out << fmt::format(R"(,
+  {{"name": "{}", "cat": "samurai", "ph": "X", "pid": {}, "tid": {}, "ts": {:.3f}, "dur": {:.3f}}})",
+                                   escape(m_names[event.region]),
+                                   rank,
+                                   thread->index(),
+                                   1e-3 * static_cast<double>(event.begin),
+                                   1e-3 * static_cast<double>(event.end - event.begin));
+            }
+        }
+        out << "\n]}\n";
+    }
+}
+
+#define SAMURAI_PROFILING_CONCAT_IMPL(a, b) a##b
+#define SAMURAI_PROFILING_CONCAT(a, b)      SAMURAI_PROFILING_CONCAT_IMPL(a, b)
+
+/**
+ * Opens the region of the given name until the end of the enclosing scope.
+ * The id of the region is computed once, at the first execution of the line.
+ */
+#define SAMURAI_PROFILE_REGION_IMPL(id, region, name)                                            \
+    static const samurai::profiling::region_id_t id = samurai::profiling::register_region(name); \
+    const samurai::profiling::ScopedRegion region(id)
+
+#define SAMURAI_PROFILE_REGION(name)                                                     \
+    SAMURAI_PROFILE_REGION_IMPL(SAMURAI_PROFILING_CONCAT(samurai_region_id_, __LINE__), \
+                                SAMURAI_PROFILING_CONCAT(samurai_region_, __LINE__),    \
+                                name)
@@ -1,10 +1,16 @@
 #pragma once
 
 #include <array>
+#include <cassert>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "field.hpp"
 #include "numeric/prediction.hpp"
@@ -305,12 +311,20 @@ namespace samurai
 
     }
 
+    /**
+     * Prediction coefficients of the cell of offset (indices...) among the 2^(dim*level) cells obtained by refining a cell level times.
+     * The result is memoized; the returned map is built recursively and is meant for precomputation:
+     * use prediction_coefficients() in loops.
+     */
     template <std::size_t order = 1, class... index_t>
     auto& prediction(std::size_t level, index_t... indices)
     {
         static constexpr std::size_t dim = sizeof...(index_t);
 
         static std::unordered_map<std::tuple<std::size_t, std::size_t, index_t...>, prediction_map<dim, default_config::value_t>> values;
+        static std::recursive_mutex mutex;
+
+        std::lock_guard<std::recursive_mutex> lock(mutex);
 
         auto key  = std::make_tuple(order, level, indices...);
         auto iter = values.find(key);
@@ -362,6 +376,110 @@ namespace samurai
         return values[key];
     }
 
+    template <std::size_t dim, class index_t = default_config::value_t>
+    struct prediction_coefficient
+    {
+        std::array<index_t, dim> offset; // relative to the coarse cell
+        double value;
+    };
+
+    /**
+     * Flat table of the prediction coefficients of all the cells obtained by refining a cell delta_l times.
+     * The coefficients of each fine cell are stored contiguously, the fine cells being ordered by their offset
+     * (ii, jj, kk) in [0, 2^delta_l)^dim, with ii varying fastest.
+     */
+    template <std::size_t dim, class index_t = default_config::value_t>
+    class prediction_table
+    {
+      public:
+
+        using coefficient_t = prediction_coefficient<dim, index_t>;
+
+        prediction_table() = default;
+
+        template <std::size_t order>
+        static prediction_table build(std::size_t delta_l)
+        {
+            prediction_table table;
+            table.m_nb_cells = index_t{1} << delta_l;
+
+            std::size_t nb_children = 1;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                nb_children *= static_cast<std::size_t>(table.m_nb_cells);
+            }
+            table.m_starts.reserve(nb_children + 1);
+            table.m_starts.push_back(0);
+
+            std::array<index_t, dim> child;
+            child.fill(0);
+            for (std::size_t c = 0; c < nb_children; ++c)
+            {
+                const auto& pred = std::apply(
+                    [&](auto... indices) -> auto&
+                    {
+                        return prediction<order>(delta_l, indices...);
+                    },
+                    child);
+                for (const auto& kv : pred.coeff)
+                {
+                    table.m_coefficients.push_back({kv.first, kv.second});
+                }
+                table.m_starts.push_back(table.m_coefficients.size());
+
+                // next child, ii varying fastest
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    if (++child[d] < table.m_nb_cells)
+                    {
+                        break;
+                    }
+                    child[d] = 0;
+                }
+            }
+            return table;
+        }
+
+        template <class... child_index_t>
+        std::span<const coefficient_t> operator()(child_index_t... child) const
+        {
+            static_assert(sizeof...(child_index_t) == dim);
+
+            std::size_t c      = 0;
+            std::size_t stride = 1;
+            ((c += static_cast<std::size_t>(child) * stride, stride *= static_cast<std::size_t>(m_nb_cells)), ...);
+            return {m_coefficients.data() + m_starts[c], m_coefficients.data() + m_starts[c + 1]};
+        }
+
+      private:
+
+        index_t m_nb_cells = 1;
+        std::vector<std::size_t> m_starts;
+        std::vector<coefficient_t> m_coefficients;
+    };
+
+    /**
+     * Prediction coefficients of order 'order' for the level difference delta_l.
+     * The table of each level difference is built once, at its first use, and can then be read concurrently.
+     */
+    template <std::size_t order, std::size_t dim, class index_t = default_config::value_t>
+    const prediction_table<dim, index_t>& prediction_coefficients(std::size_t delta_l)
+    {
+        static constexpr std::size_t n_tables = default_config::max_level + 1;
+
+        static std::array<std::once_flag, n_tables> flags;
+        static std::array<std::unique_ptr<prediction_table<dim, index_t>>, n_tables> tables;
+
+        assert(delta_l < n_tables);
+        std::call_once(flags[delta_l],
+                       [&]()
+                       {
+                           tables[delta_l] = std::make_unique<prediction_table<dim, index_t>>(
+                               prediction_table<dim, index_t>::template build<order>(delta_l));
+                       });
+        return *tables[delta_l];
+    }
+
     template <std::size_t dim, class TInterval>
     class reconstruction_op_ : public field_operator_base<dim, TInterval>
     {
@@ -414,15 +532,16 @@ namespace samurai
             }
             else
             {
+                const auto& table = prediction_coefficients<prediction_stencil_radius, 1>(delta_l);
+
                 index_t nb_cells = 1 << delta_l;
                 for (index_t ii = 0; ii < nb_cells; ++ii)
                 {
-                    auto pred = prediction<prediction_stencil_radius, index_t>(delta_l, ii);
-                    for (const auto& kv : pred.coeff)
+                    auto i_f = (i << delta_l) + ii;
+                    i_f.step = nb_cells;
+                    for (const auto& [offset, c] : table(ii))
                     {
-                        auto i_f = (i << delta_l) + ii;
-                        i_f.step = nb_cells;
-                        dest(reconstruct_level, i_f) += kv.second * src(level, i + kv.first[0]);
+                        dest(reconstruct_level, i_f) += c * src(level, i + offset[0]);
                     }
                 }
             }
@@ -442,19 +561,20 @@ namespace samurai
             }
             else
             {
+                const auto& table = prediction_coefficients<prediction_stencil_radius, 2>(delta_l);
+
                 index_t nb_cells = 1 << delta_l;
                 for (index_t jj = 0; jj < nb_cells; ++jj)
                 {
                     auto j_f = (j << delta_l) + jj;
                     for (index_t ii = 0; ii < nb_cells; ++ii)
                     {
-                        const auto& pred = prediction<prediction_stencil_radius, index_t>(delta_l, ii, jj);
-                        auto i_f         = (i << delta_l) + ii;
-                        i_f.step         = nb_cells;
+                        auto i_f = (i << delta_l) + ii;
+                        i_f.step = nb_cells;
 
-                        for (const auto& kv : pred.coeff)
+                        for (const auto& [offset, c] : table(ii, jj))
                         {
-                            dest(reconstruct_level, i_f, j_f) += kv.second * src(level, i + kv.first[0], j + kv.first[1]);
+                            dest(reconstruct_level, i_f, j_f) += c * src(level, i + offset[0], j + offset[1]);
                         }
                     }
                 }
@@ -474,6 +594,8 @@ namespace samurai
             }
             else
             {
+                const auto& table = prediction_coefficients<prediction_stencil_radius, 3>(delta_l);
+
                 index_t nb_cells = 1 << delta_l;
                 for (index_t kk = 0; kk < nb_cells; ++kk)
                 {
@@ -483,14 +605,12 @@ namespace samurai
                         auto j_f = (j << delta_l) + jj;
                         for (index_t ii = 0; ii < nb_cells; ++ii)
                         {
-                            const auto& pred = prediction<prediction_stencil_radius, index_t>(delta_l, ii, jj, kk);
-                            auto i_f         = (i << delta_l) + ii;
-                            i_f.step         = nb_cells;
+                            auto i_f = (i << delta_l) + ii;
+                            i_f.step = nb_cells;
 
-                            for (const auto& kv : pred.coeff)
+                            for (const auto& [offset, c] : table(ii, jj, kk))
                             {
-                                dest(reconstruct_level, i_f, j_f, k_f) += kv.second
-                                                                        * src(level, i + kv.first[0], j + kv.first[1], k + kv.first[2]);
+                                dest(reconstruct_level, i_f, j_f, k_f) += c * src(level, i + offset[0], j + offset[1], k + offset[2]);
                             }
                         }
                     }
@@ -559,58 +679,62 @@ namespace samurai
 
     namespace detail
     {
+        /**
+         * Sum of the prediction coefficients of the fine cells spanned by the intervals ii,
+         * memoized per (level, delta_l, ii).
+         */
         template <std::size_t prediction_stencil_radius, class Field, class... index_t>
             requires(Field::dim == sizeof...(index_t) + 1 && (std::same_as<typename Field::interval_t, index_t> && ...))
-        decltype(auto) get_prediction(std::size_t level, std::size_t delta_l, const std::tuple<index_t...>& ii)
+        std::span<const prediction_coefficient<Field::dim>>
+        get_prediction(std::size_t level, std::size_t delta_l, const std::tuple<index_t...>& ii)
         {
             static constexpr std::size_t dim = Field::dim;
             using value_t                    = typename Field::interval_t::value_t;
-            static std::unordered_map<std::tuple<std::size_t, std::size_t, typename Field::interval_t, index_t...>, prediction_map<dim, value_t>>
-                values;
+            using key_t                      = std::tuple<std::size_t, std::size_t, index_t...>;
 
-            auto iter = std::apply(
+            static std::unordered_map<key_t, std::vector<prediction_coefficient<dim>>> values;
+            static std::shared_mutex mutex;
+
+            key_t key = std::apply(
                 [&](auto&... index)
                 {
-                    return values.find({prediction_stencil_radius, level, index...});
+                    return key_t{level, delta_l, index...};
                 },
                 ii);
 
-            if (iter == values.end())
             {
-                multi_dim_loop(
-                    ii,
-                    [&](auto... ii_)
-                    {
-                        std::apply(
-                            [&](auto&... index)
-                            {
-                                values[{prediction_stencil_radius, level, index...}] += prediction<prediction_stencil_radius, value_t>(
-                                    delta_l,
-                                    ii_...);
-                            },
-                            ii);
-                    });
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                auto iter = values.find(key);
+                if (iter != values.end())
+                {
+                    return iter->second;
+                }
             }
 
-            return std::apply(
-                [&](auto&... index) -> auto&
-                {
-                    return values[{prediction_stencil_radius, level, index...}];
-                },
-                ii);
+            prediction_map<dim> pred;
+            multi_dim_loop(ii,
+                           [&](auto... ii_)
+                           {
+                               pred += prediction<prediction_stencil_radius, value_t>(delta_l, ii_...);
+                           });
+
+            std::vector<prediction_coefficient<dim>> coefficients;
+            coefficients.reserve(pred.coeff.size());
+            for (const auto& kv : pred.coeff)
+            {
+                coefficients.push_back({kv.first, kv.second});
+            }
+
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            return values.try_emplace(key, std::move(coefficients)).first->second;
         }
 
         template <std::size_t prediction_stencil_radius, class Field, class... index_t>
             requires((std::same_as<typename Field::interval_t::value_t, index_t> && ...))
-        decltype(auto) get_prediction(std::size_t, std::size_t delta_l, const std::tuple<index_t...>& ii)
+        std::span<const prediction_coefficient<Field::dim>> get_prediction(std::size_t, std::size_t delta_l, const std::tuple<index_t...>& ii)
         {
-            using value_t = typename Field::interval_t::value_t;
-            return std::apply(
-                [delta_l](const auto&... index) -> auto&
-                {
-                    return prediction<prediction_stencil_radius, value_t>(delta_l, index...);
-                },
-                ii);
+            const auto& table = prediction_coefficients<prediction_stencil_radius, Field::dim>(delta_l);
+            return std::apply(table, ii);
         }
 
         template <std::size_t prediction_stencil_radius, class Field, class Func, class... index_t, class... cell_index_t>
@@ -627,7 +751,7 @@ namespace samurai
         {
             using result_t = std::decay_t<decltype(result)>;
 
-            const auto& pred = get_prediction<prediction_stencil_radius, Field>(level, delta_l, ii);
+            const auto pred = get_prediction<prediction_stencil_radius, Field>(level, delta_l, ii);
 
             if constexpr (std::is_same_v<result_t, double>)
             {
@@ -638,21 +762,21 @@ namespace samurai
                 result.fill(0.);
             }
 
-            for (const auto& kv : pred.coeff)
+            for (const auto& [offset, c] : pred)
             {
                 std::apply(
                     [&](auto... indices)
                     {
                         if constexpr (std::is_same_v<result_t, double>)
                         {
-                            result += kv.second * get_f(level, indices...)[0];
+                            result += c * get_f(level, indices...)[0];
                         }
                         else
                         {
-                            result += kv.second * get_f(level, indices...);
+                            result += c * get_f(level, indices...);
                         }
                     },
-                    detail::compute_new_indices(0, i, kv.first));
+                    detail::compute_new_indices(0, i, offset));
             }
         }
     }
@@ -12,6 +12,7 @@ namespace mpi = boost::mpi;
 #endif
 
 #include "arguments.hpp"
+#include "memory_tracker.hpp"
 #include "timers.hpp"
 #include <thread>
 
@@ -68,6 +69,10 @@ namespace samurai
             std::cout.rdbuf(null_stream.rdbuf());
         }
 #endif
+        if (!args::trace_file.empty())
+        {
+            profiling::profiler().enable_trace();
+        }
         times::timers.start("total runtime");
 
         return app;
@@ -87,11 +92,20 @@ namespace samurai
 
     SAMURAI_INLINE void finalize()
     {
-        if (args::timers) // cppcheck-suppress knownConditionTrueFalse
+        // "total runtime" is not started by initialize() without arguments
+        if (profiling::this_thread_profile().current_region() == profiling::register_region("total runtime"))
         {
             times::timers.stop("total runtime");
+        }
+        if (args::timers) // cppcheck-suppress knownConditionTrueFalse
+        {
             std::cout << std::endl;
             times::timers.print();
+            memory_tracker().print();
+        }
+        if (!args::trace_file.empty()) // cppcheck-suppress knownConditionTrueFalse
+        {
+            profiling::profiler().save_trace(args::trace_file);
         }
 #if defined(SAMURAI_WITH_PETSC)
         PetscFinalize();
@@ -23,6 +23,8 @@
 #include "fv/operators/identity.hpp"
 #include "fv/operators/zero_operator.hpp"
 
+#include "time_integrators.hpp"
+
 #ifdef SAMURAI_WITH_PETSC
 #include "../petsc/manual_assembly.hpp"
 #include "../petsc/solver_helpers.hpp"
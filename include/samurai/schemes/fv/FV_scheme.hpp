@@ -3,8 +3,8 @@
 #include "../../boundary.hpp"
 #include "../../concepts.hpp"
 #include "../../field.hpp"
+#include "../../profiling.hpp"
 #include "../../static_algorithm.hpp"
-#include "../../timers.hpp"
 #include "utils.hpp"
 
 namespace samurai
@@ -122,6 +122,9 @@ namespace samurai
         bool m_is_symmetric = false;
         bool m_is_spd       = false;
 
+        // profiling region of the explicit application, registered once per name
+        profiling::region_id_t m_operator_region = profiling::register_region("(unnamed) operator");
+
         parameter_field_t* m_parameter_field = nullptr;
 
         std::array<directional_bdry_config_t, 2 * dim> m_dirichlet_config;
@@ -142,7 +145,8 @@ namespace samurai
 
         void set_name(const std::string& name)
         {
-            m_name = name;
+            m_name            = name;
+            m_operator_region = profiling::register_region(name + " operator");
         }
 
         virtual ~FVScheme()
@@ -212,10 +216,10 @@ namespace samurai
         {
             this->update_ghosts_if_needed(input_field);
 
-            times::timers.start(name() + " operator");
+            profiling::ScopedRegion region(m_operator_region);
             auto explicit_scheme = make_explicit(derived_cast());
             auto output_field    = explicit_scheme.apply_to(input_field);
-            times::timers.stop(name() + " operator");
+            profiling::add_field_bytes(input_field, output_field);
             return output_field;
         }
 
@@ -223,20 +227,20 @@ namespace samurai
         {
             this->update_ghosts_if_needed(input_field);
 
-            times::timers.start(name() + " operator");
+            profiling::ScopedRegion region(m_operator_region);
             auto explicit_scheme = make_explicit(derived_cast());
             explicit_scheme.apply(output_field, input_field);
-            times::timers.stop(name() + " operator");
+            profiling::add_field_bytes(input_field, output_field);
         }
 
         auto operator()(std::size_t d, input_field_t& input_field)
         {
             this->update_ghosts_if_needed(input_field);
 
-            times::timers.start(name() + " operator");
+            profiling::ScopedRegion region(m_operator_region);
             auto explicit_scheme = make_explicit(derived_cast());
             auto output_field    = explicit_scheme.apply_to(d, input_field);
-            times::timers.stop(name() + " operator");
+            profiling::add_field_bytes(input_field, output_field);
             return output_field;
         }
 
@@ -244,10 +248,10 @@ namespace samurai
         {
             this->update_ghosts_if_needed(input_field);
 
-            times::timers.start(name() + " operator");
+            profiling::ScopedRegion region(m_operator_region);
             auto explicit_scheme = make_explicit(derived_cast());
             explicit_scheme.apply(d, output_field, input_field);
-            times::timers.stop(name() + " operator");
+            profiling::add_field_bytes(input_field, output_field);
         }
 
         /**
@@ -53,6 +53,24 @@ namespace samurai
             return output_field;
         }
 
+        /**
+         * Exits if the stencil of the scheme is larger than the one the ghosts of the mesh are built for.
+         */
+        void check_stencil_size(const input_field_t& input_field) const
+        {
+            static constexpr int scheme_stencil_size = static_cast<int>(scheme_t::cfg_t::stencil_size);
+            int mesh_stencil_size                    = input_field.mesh().cfg().max_stencil_size();
+
+            if (scheme_stencil_size > mesh_stencil_size)
+            {
+                std::cerr << "The stencil size required by the scheme '" << scheme().name() << "' (" << scheme_stencil_size
+                          << ") is larger than the max_stencil_size parameter of the mesh (" << mesh_stencil_size
+                          << ").\nYou can set it with mesh_config.max_stencil_radius(" << scheme_stencil_size / 2
+                          << ") or mesh_config.max_stencil_size(" << scheme_stencil_size << ")." << std::endl;
+                exit(EXIT_FAILURE);
+            }
+        }
+
       public:
 
         auto apply_to(input_field_t& input_field)
@@ -75,17 +93,7 @@ namespace samurai
 
         virtual void apply(output_field_t& output_field, input_field_t& input_field)
         {
-            static constexpr int scheme_stencil_size = static_cast<int>(scheme_t::cfg_t::stencil_size);
-            int mesh_stencil_size                    = input_field.mesh().cfg().max_stencil_size();
-
-            if (scheme_stencil_size > mesh_stencil_size)
-            {
-                std::cerr << "The stencil size required by the scheme '" << scheme().name() << "' (" << scheme_stencil_size
-                          << ") is larger than the max_stencil_size parameter of the mesh (" << mesh_stencil_size
-                          << ").\nYou can set it with mesh_config.max_stencil_radius(" << scheme_stencil_size / 2
-                          << ") or mesh_config.max_stencil_size(" << scheme_stencil_size << ")." << std::endl;
-                exit(EXIT_FAILURE);
-            }
+            check_stencil_size(input_field);
 
             for (std::size_t d = 0; d < dim; ++d)
             {
@@ -1,4 +1,7 @@
 #pragma once
+#include <algorithm>
+
+#include "../../../algorithm/update.hpp"
 #include "../explicit_FV_scheme.hpp"
 #include "flux_based_scheme__nonlin.hpp"
 
@@ -24,6 +27,8 @@ namespace samurai
       public:
 
         using base_class::apply;
+        using base_class::apply_to;
+        using base_class::dim;
 
         explicit Explicit(scheme_t& s)
             : base_class(s)
@@ -34,19 +39,30 @@ namespace samurai
 
         template <bool enable_finer_level_flux>
         void _apply(std::size_t d, output_field_t& output_field, input_field_t& input_field)
+        {
+            _apply<enable_finer_level_flux>(d,
+                                            output_field,
+                                            input_field,
+                                            [](const auto&)
+                                            {
+                                                return true;
+                                            });
+        }
+
+        template <bool enable_finer_level_flux, class Filter>
+        void _apply(std::size_t d, output_field_t& output_field, input_field_t& input_field, const Filter& interior_filter)
         {
             // Interior interfaces
-            scheme().template for_each_interior_interface<Run::Parallel, enable_finer_level_flux>( // We need the 'template' keyword...
+            // (the coloured traversal guarantees that two threads never write into the same cell)
+            scheme().template for_each_interior_interface<Run::ParallelColoured, enable_finer_level_flux>( // We need the 'template' keyword...
                 d,
                 input_field,
+                interior_filter,
                 [&](const auto& cell, auto& contrib)
                 {
                     for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
                     {
-                    // clang-format off
-                        #pragma omp atomic update
                         field_value(output_field, cell, field_i) += this->scheme().flux_value_cmpnent(contrib, field_i);
-                        // clang-format on
                     }
                 });
 
@@ -81,5 +97,89 @@ namespace samurai
                 _apply<false>(d, output_field, input_field);
             }
         }
+
+        /**
+         * Same as apply(), overlapping the ghost update started by begin_update_ghosts(input_field, ...)
+         * with the computation of the fluxes whose stencil only contains cells of the subdomain.
+         * The other fluxes are computed once the ghost update is completed.
+         */
+        template <class... Fields>
+        void apply(output_field_t& output_field, input_field_t& input_field, GhostUpdateHandle<Fields...>& ghost_update)
+        {
+            this->check_stencil_size(input_field);
+
+            if (args::finer_level_flux != 0 || scheme().enable_finer_level_flux()) // cppcheck-suppress knownConditionTrueFalse
+            {
+                // The fluxes at finer levels use predicted values: no overlap.
+                end_update_ghosts(ghost_update);
+                base_class::apply(output_field, input_field);
+                return;
+            }
+
+            using mesh_id_t = typename input_field_t::mesh_t::mesh_id_t;
+
+            // The mask of the leaves is computed once per mesh: it is dropped with the subset cache when the mesh changes.
+            auto& mesh          = input_field.mesh();
+            auto make_leaf_mask = [&]()
+            {
+                std::vector<bool> mask(mesh.nb_cells(), false);
+                for_each_cell(mesh[mesh_id_t::cells],
+                              [&](const auto& cell)
+                              {
+                                  mask[static_cast<std::size_t>(cell.index)] = true;
+                              });
+                return mask;
+            };
+            const auto& is_leaf = mesh.subset_cache().get_cell_mask("leaves", make_leaf_mask);
+            auto only_leaves = [&](const auto& stencil_cells)
+            {
+                return std::all_of(stencil_cells.begin(),
+                                   stencil_cells.end(),
+                                   [&](const auto& cell)
+                                   {
+                                       return is_leaf[static_cast<std::size_t>(cell.index)];
+                                   });
+            };
+
+            // The cells of the subdomain are not modified by the ghost update.
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                scheme().template for_each_interior_interface<Run::ParallelColoured, false>(
+                    d,
+                    input_field,
+                    only_leaves,
+                    [&](const auto& cell, auto& contrib)
+                    {
+                        for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
+                        {
+                            field_value(output_field, cell, field_i) += this->scheme().flux_value_cmpnent(contrib, field_i);
+                        }
+                    });
+            }
+
+            end_update_ghosts(ghost_update);
+
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                scheme().apply_directional_bc(input_field, d);
+                _apply<false>(d,
+                              output_field,
+                              input_field,
+                              [&](const auto& stencil_cells)
+                              {
+                                  return !only_leaves(stencil_cells);
+                              });
+            }
+        }
+
+        template <class... Fields>
+        auto apply_to(input_field_t& input_field, GhostUpdateHandle<Fields...>& ghost_update)
+        {
+            output_field_t output_field = this->create_output_field(input_field);
+
+            apply(output_field, input_field, ghost_update);
+
+            return output_field;
+        }
     };
 } // end namespace samurai
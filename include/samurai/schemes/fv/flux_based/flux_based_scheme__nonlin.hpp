@@ -328,12 +328,13 @@ namespace samurai
             }
         }
 
-        template <bool enable_finer_level_flux, class InterfaceIterator, class StencilIterator, class FluxFunction, class Func>
+        template <bool enable_finer_level_flux, class InterfaceIterator, class StencilIterator, class FluxFunction, class Filter, class Func>
         void process_interior_interfaces(const FluxParameters<enable_finer_level_flux>& flux_params,
                                          InterfaceIterator& interface_it,
                                          StencilIterator& comput_stencil_it,
                                          const FluxFunction& flux_function,
                                          const input_field_t& field,
+                                         const Filter& filter,
                                          Func&& apply_contrib)
         {
             std::vector<StencilValues<cfg>> stencil_values_list(flux_params.n_fine_fluxes);
@@ -344,15 +345,18 @@ namespace samurai
 
             for (std::size_t ii = 0; ii < comput_stencil_it.interval().size(); ++ii)
             {
-                compute_stencil_values<enable_finer_level_flux>(flux_params, comput_stencil_it.cells(), field, stencil_values_list);
-
-                for (std::size_t k = 0; k < flux_params.n_fine_fluxes; ++k)
+                if (filter(comput_stencil_it.cells()))
                 {
-                    flux_function(flux_values, data, stencil_values_list[k]);
-                    flux_values[0] *= flux_params.left_factor;
-                    flux_values[1] *= flux_params.right_factor;
-                    apply_contrib(interface_it.cells()[0], flux_values[0]);
-                    apply_contrib(interface_it.cells()[1], flux_values[1]);
+                    compute_stencil_values<enable_finer_level_flux>(flux_params, comput_stencil_it.cells(), field, stencil_values_list);
+
+                    for (std::size_t k = 0; k < flux_params.n_fine_fluxes; ++k)
+                    {
+                        flux_function(flux_values, data, stencil_values_list[k]);
+                        flux_values[0] *= flux_params.left_factor;
+                        flux_values[1] *= flux_params.right_factor;
+                        apply_contrib(interface_it.cells()[0], flux_values[0]);
+                        apply_contrib(interface_it.cells()[1], flux_values[1]);
+                    }
                 }
 
                 interface_it.move_next();
@@ -405,6 +409,22 @@ namespace samurai
          */
         template <Run run_type = Run::Sequential, bool enable_finer_level_flux, class Func>
         void for_each_interior_interface(std::size_t d, input_field_t& field, Func&& apply_contrib)
+        {
+            for_each_interior_interface<run_type, enable_finer_level_flux>(
+                d,
+                field,
+                [](const auto&)
+                {
+                    return true;
+                },
+                std::forward<Func>(apply_contrib));
+        }
+
+        /**
+         * Same as above, restricted to the interfaces whose computational stencil satisfies filter(stencil_cells).
+         */
+        template <Run run_type = Run::Sequential, bool enable_finer_level_flux, class Filter, class Func>
+        void for_each_interior_interface(std::size_t d, input_field_t& field, const Filter& filter, Func&& apply_contrib)
         {
             auto& mesh = field.mesh();
 
@@ -444,6 +464,7 @@ namespace samurai
                                                                                           comput_stencil_it,
                                                                                           flux_function,
                                                                                           field,
+                                                                                          filter,
                                                                                           std::forward<Func>(apply_contrib));
                                                                                   });
             }
@@ -486,6 +507,7 @@ namespace samurai
                                                                                  comput_stencil_it,
                                                                                  flux_function,
                                                                                  field,
+                                                                                 filter,
                                                                                  std::forward<Func>(apply_contrib));
                         });
                 }
@@ -509,6 +531,7 @@ namespace samurai
                                                                                  comput_stencil_it,
                                                                                  flux_function,
                                                                                  field,
+                                                                                 filter,
                                                                                  std::forward<Func>(apply_contrib));
                         });
                 }
@@ -0,0 +1,245 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace samurai
+{
+    enum class RungeKuttaMethod
+    {
+        ForwardEuler,
+        SSPRK2,
+        SSPRK3,
+        RK4,
+        LowStorageRK4 ///< 2N-storage, 5-stage, 4th order scheme of Carpenter and Kennedy (1994).
+    };
+
+    /**
+     * Explicit Runge-Kutta integrator for the semi-discrete problem
+     *
+     *     du/dt + op(u) = 0.
+     *
+     * The stage fields are allocated once, on the mesh of the solution field, and reused at every time step:
+     * the operator is applied into them with op.apply(), which accumulates into an existing field,
+     * instead of op(u), which allocates a new field at each call.
+     * The linear combinations of each stage are evaluated in a single pass over the mesh,
+     * and the solution field is updated in place.
+     *
+     * After a mesh adaptation, the stage fields are resized at the next call to step().
+     * The boundary conditions of the solution field are copied into the stage fields at construction;
+     * call copy_bc_from_solution() if they are redefined afterwards.
+     */
+    template <class Operator>
+    class ExplicitRungeKutta
+    {
+      public:
+
+        using operator_t = Operator;
+        using field_t    = typename operator_t::input_field_t;
+
+        static_assert(std::is_same_v<field_t, typename operator_t::output_field_t>,
+                      "The Runge-Kutta integrators require an operator whose output field type is its input field type.");
+
+      private:
+
+        operator_t* m_op = nullptr;
+        field_t* m_u     = nullptr;
+        RungeKuttaMethod m_method;
+
+        field_t m_k;                    // operator evaluation (increment for the low-storage scheme)
+        std::optional<field_t> m_stage; // intermediate solution (multi-stage schemes, except the low-storage one)
+        std::optional<field_t> m_acc;   // weighted sum of the evaluations (classical RK4 only)
+
+        std::size_t m_nb_cells;
+
+      public:
+
+        ExplicitRungeKutta(operator_t& op, field_t& u, RungeKuttaMethod method = RungeKuttaMethod::SSPRK3)
+            : m_op(&op)
+            , m_u(&u)
+            , m_method(method)
+            , m_k(u.name() + "_rk_k", u.mesh())
+            , m_nb_cells(u.mesh().nb_cells())
+        {
+            if (m_method == RungeKuttaMethod::SSPRK2 || m_method == RungeKuttaMethod::SSPRK3 || m_method == RungeKuttaMethod::RK4)
+            {
+                m_stage.emplace(u.name() + "_rk_stage", u.mesh());
+            }
+            if (m_method == RungeKuttaMethod::RK4)
+            {
+                m_acc.emplace(u.name() + "_rk_acc", u.mesh());
+            }
+            copy_bc_from_solution();
+        }
+
+        auto method() const
+        {
+            return m_method;
+        }
+
+        std::size_t order() const
+        {
+            switch (m_method)
+            {
+                case RungeKuttaMethod::ForwardEuler:
+                    return 1;
+                case RungeKuttaMethod::SSPRK2:
+                    return 2;
+                case RungeKuttaMethod::SSPRK3:
+                    return 3;
+                default:
+                    return 4;
+            }
+        }
+
+        /**
+         * Copies the boundary conditions of the solution field into the stage fields,
+         * whose ghosts are filled when the operator is applied to them.
+         */
+        void copy_bc_from_solution()
+        {
+            if (m_stage)
+            {
+                m_stage->copy_bc_from(*m_u);
+            }
+        }
+
+        /**
+         * Advances the solution field by one time step.
+         */
+        void step(double dt)
+        {
+            resize_if_needed();
+
+            auto& u = *m_u;
+            switch (m_method)
+            {
+                case RungeKuttaMethod::ForwardEuler:
+                {
+                    evaluate(u);
+                    u = u - dt * m_k;
+                    break;
+                }
+                case RungeKuttaMethod::SSPRK2:
+                {
+                    auto& stage = *m_stage;
+                    evaluate(u);
+                    stage = u - dt * m_k;
+                    evaluate(stage);
+                    u = 1. / 2 * u + 1. / 2 * (stage - dt * m_k);
+                    break;
+                }
+                case RungeKuttaMethod::SSPRK3:
+                {
+                    auto& stage = *m_stage;
+                    evaluate(u);
+                    stage = u - dt * m_k;
+                    evaluate(stage);
+                    stage = 3. / 4 * u + 1. / 4 * (stage - dt * m_k);
+                    evaluate(stage);
+                    u = 1. / 3 * u + 2. / 3 * (stage - dt * m_k);
+                    break;
+                }
+                case RungeKuttaMethod::RK4:
+                {
+                    auto& stage = *m_stage;
+                    auto& acc   = *m_acc;
+                    evaluate(u);
+                    acc   = 1. * m_k;
+                    stage = u - dt / 2 * m_k;
+                    evaluate(stage);
+                    acc   = acc + 2. * m_k;
+                    stage = u - dt / 2 * m_k;
+                    evaluate(stage);
+                    acc   = acc + 2. * m_k;
+                    stage = u - dt * m_k;
+                    evaluate(stage);
+                    u = u - dt / 6 * (acc + m_k);
+                    break;
+                }
+                case RungeKuttaMethod::LowStorageRK4:
+                {
+                    low_storage_step(dt);
+                    break;
+                }
+            }
+        }
+
+      private:
+
+        void resize_if_needed()
+        {
+            if (m_u->mesh().nb_cells() != m_nb_cells)
+            {
+                m_k.resize();
+                if (m_stage)
+                {
+                    m_stage->resize();
+                }
+                if (m_acc)
+                {
+                    m_acc->resize();
+                }
+                m_nb_cells = m_u->mesh().nb_cells();
+            }
+        }
+
+        /**
+         * m_k <-- op(v), without allocation.
+         */
+        void evaluate(field_t& v)
+        {
+            m_k.fill(0);
+            m_op->apply(m_k, v);
+        }
+
+        /**
+         * Williamson's 2N-storage form: for each stage s,
+         *     du <-- A_s du - dt op(u),
+         *     u  <-- u + B_s du.
+         * The scaled increment is formed in place, so that only the solution and one increment field are used.
+         */
+        void low_storage_step(double dt)
+        {
+            static constexpr std::array<double, 5> A{0.,
+                                                     -567301805773. / 1357537059087.,
+                                                     -2404267990393. / 2016746695238.,
+                                                     -3550918686646. / 2091501179385.,
+                                                     -1275806237668. / 842570457699.};
+            static constexpr std::array<double, 5> B{1432997174477. / 9575080441755.,
+                                                     5161836677717. / 13612068292357.,
+                                                     1720146321549. / 2090206949498.,
+                                                     3134564353537. / 4481467310338.,
+                                                     2277821191437. / 14882151754819.};
+
+            auto& u  = *m_u;
+            auto& du = m_k;
+            for (std::size_t s = 0; s < A.size(); ++s)
+            {
+                if (s == 0)
+                {
+                    du.fill(0);
+                }
+                else
+                {
+                    du = -A[s] / dt * du;
+                }
+                m_op->apply(du, u);
+                du = -dt * du;
+                u  = u + B[s] * du;
+            }
+        }
+    };
+
+    template <class Operator>
+    auto make_explicit_runge_kutta(Operator& op, typename Operator::input_field_t& u, RungeKuttaMethod method = RungeKuttaMethod::SSPRK3)
+    {
+        return ExplicitRungeKutta<Operator>(op, u, method);
+    }
+} // end namespace samurai
@@ -0,0 +1,137 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace samurai
+{
+    /**
+     * Method used to distribute the cells between the MPI subdomains.
+     *  - Intervals: the domain is split by counting the x-intervals (the cells in 1D) at start_level;
+     *  - Morton, Hilbert: the leaf cells of all levels are ordered along the space-filling curve,
+     *    which is then cut into chunks of equal weight.
+     */
+    enum class Partitioning
+    {
+        Intervals,
+        Morton,
+        Hilbert
+    };
+
+    inline Partitioning partitioning_from_string(const std::string& name)
+    {
+        if (name == "intervals")
+        {
+            return Partitioning::Intervals;
+        }
+        if (name == "morton")
+        {
+            return Partitioning::Morton;
+        }
+        if (name == "hilbert")
+        {
+            return Partitioning::Hilbert;
+        }
+        std::cerr << "Unknown partitioning method '" << name << "' (expected: intervals, morton or hilbert)." << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    namespace sfc
+    {
+        /**
+         * Interleaves the n_bits lowest bits of the coordinates, the first coordinate giving the most significant bit
+         * of each group of dim bits.
+         */
+        template <std::size_t dim>
+        std::uint64_t interleave(const std::array<std::uint64_t, dim>& coords, std::size_t n_bits)
+        {
+            std::uint64_t key = 0;
+            for (std::size_t b = n_bits; b-- > 0;)
+            {
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    key = (key << 1) | ((coords[d] >> b) & 1);
+                }
+            }
+            return key;
+        }
+
+        /**
+         * Position of the point of integer coordinates along the Morton (Z-order) curve.
+         * The coordinates must be smaller than 2^n_bits and dim * n_bits must not exceed 64.
+         */
+        template <std::size_t dim>
+        std::uint64_t morton_key(const std::array<std::uint64_t, dim>& coords, std::size_t n_bits)
+        {
+            return interleave(coords, n_bits);
+        }
+
+        /**
+         * Position of the point of integer coordinates along the Hilbert curve.
+         * The coordinates must be smaller than 2^n_bits and dim * n_bits must not exceed 64.
+         *
+         * The coordinates are first transformed into the "transposed" Hilbert index
+         * (J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 2004), whose bits are then interleaved.
+         */
+        template <std::size_t dim>
+        std::uint64_t hilbert_key(std::array<std::uint64_t, dim> x, std::size_t n_bits)
+        {
+            if (n_bits == 0)
+            {
+                return 0;
+            }
+            const std::uint64_t m = std::uint64_t{1} << (n_bits - 1);
+
+            // Inverse undo
+            for (std::uint64_t q = m; q > 1; q >>= 1)
+            {
+                const std::uint64_t p = q - 1;
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    if (x[d] & q)
+                    {
+                        x[0] ^= p;
+                    }
+                    else
+                    {
+                        const std::uint64_t t = (x[0] ^ x[d]) & p;
+                        x[0] ^= t;
+                        x[d] ^= t;
+                    }
+                }
+            }
+
+            // Gray encode
+            for (std::size_t d = 1; d < dim; ++d)
+            {
+                x[d] ^= x[d - 1];
+            }
+            std::uint64_t t = 0;
+            for (std::uint64_t q = m; q > 1; q >>= 1)
+            {
+                if (x[dim - 1] & q)
+                {
+                    t ^= q - 1;
+                }
+            }
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                x[d] ^= t;
+            }
+
+            return interleave(x, n_bits);
+        }
+
+        template <std::size_t dim>
+        std::uint64_t key(Partitioning method, const std::array<std::uint64_t, dim>& coords, std::size_t n_bits)
+        {
+            return (method == Partitioning::Hilbert) ? hilbert_key(coords, n_bits) : morton_key(coords, n_bits);
+        }
+    } // namespace sfc
+} // namespace samurai
@@ -7,6 +7,8 @@
 #if defined(WITH_STATS)
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
+
+#include "memory.hpp"
 #endif
 
 namespace samurai
@@ -67,12 +69,32 @@ namespace samurai
                 by_level[fmt::format("{:02}", l)] = result;
             }
 
+            // Memory of each mesh id, and the usages recorded by the memory tracker since the beginning of the run
+            json memory;
+            for (std::size_t i = 0; i < static_cast<std::size_t>(mesh_id_t::count); ++i)
+            {
+                auto id                                   = static_cast<mesh_id_t>(i);
+                memory["mesh ids"][fmt::format("{}", id)] = memory_usage(mesh[id]);
+            }
+            for (const auto& e : memory_tracker().entries())
+            {
+                memory["tracker"][e.subsystem][e.name] = {
+                    {"current", e.usage.current},
+                    {"peak",    e.usage.peak   }
+                };
+            }
+            auto total                     = memory_tracker().total();
+            memory["total"]                = total.current;
+            memory["total peak"]           = total.peak;
+            memory["peak resident memory"] = peak_resident_memory();
+
             if (stats.contains(test_case))
             {
                 stats[test_case].push_back({
                     {"min_level", min_level},
                     {"max_level", max_level},
-                    {"by_level",  by_level }
+                    {"by_level",  by_level },
+                    {"memory",    memory   }
                 });
             }
             else
@@ -81,7 +103,8 @@ namespace samurai
                 out.push_back({
                     {"min_level", min_level},
                     {"max_level", max_level},
-                    {"by_level",  by_level }
+                    {"by_level",  by_level },
+                    {"memory",    memory   }
                 });
                 stats[test_case] = out;
             }
@@ -1,4 +1,11 @@
 #pragma once
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "indices.hpp"
 #include "static_algorithm.hpp"
 
@@ -564,6 +571,130 @@ namespace samurai
         return rotated_stencil;
     }
 
+    /**
+     * Start indices of the cells of a stencil for the origin intervals already met on a mesh,
+     * so that the lookups in the mesh are done only once as long as the mesh does not change.
+     * Several threads can read and fill the cache concurrently.
+     */
+    template <class Mesh, std::size_t stencil_size>
+    class StencilIndexCache
+    {
+      public:
+
+        static constexpr std::size_t dim = Mesh::dim;
+        using mesh_interval_t            = typename Mesh::mesh_interval_t;
+        using value_t                    = typename Mesh::interval_t::value_t;
+        using index_t                    = typename Mesh::interval_t::index_t;
+        using indices_t                  = std::array<index_t, stencil_size>;
+
+        bool find(const mesh_interval_t& origin, indices_t& indices) const
+        {
+            std::shared_lock lock(m_mutex);
+            auto it = m_indices.find(key(origin));
+            if (it == m_indices.end())
+            {
+                return false;
+            }
+            indices = it->second;
+            return true;
+        }
+
+        void insert(const mesh_interval_t& origin, const indices_t& indices)
+        {
+            std::unique_lock lock(m_mutex);
+            m_indices.emplace(key(origin), indices);
+        }
+
+        std::size_t size() const
+        {
+            std::shared_lock lock(m_mutex);
+            return m_indices.size();
+        }
+
+      private:
+
+        // level, start of the interval, y and z coordinates
+        using key_t = std::array<value_t, dim + 1>;
+
+        struct key_hash
+        {
+            std::size_t operator()(const key_t& k) const
+            {
+                std::size_t h = 0;
+                for (auto v : k)
+                {
+                    h ^= std::hash<value_t>{}(v) + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+                }
+                return h;
+            }
+        };
+
+        static key_t key(const mesh_interval_t& origin)
+        {
+            key_t k;
+            k[0] = static_cast<value_t>(origin.level);
+            k[1] = origin.i.start;
+            for (std::size_t d = 0; d < dim - 1; ++d)
+            {
+                k[d + 2] = origin.index[d];
+            }
+            return k;
+        }
+
+        std::unordered_map<key_t, indices_t, key_hash> m_indices;
+        mutable std::shared_mutex m_mutex;
+    };
+
+    /**
+     * Stencil index caches of a mesh, one per stencil.
+     * They are not copied with the mesh, and must be cleared when the cells or their indices change.
+     */
+    template <class Mesh>
+    class StencilIndexCaches
+    {
+      public:
+
+        StencilIndexCaches() = default;
+
+        StencilIndexCaches(const StencilIndexCaches&)
+        {
+        }
+
+        StencilIndexCaches& operator=(const StencilIndexCaches&)
+        {
+            clear();
+            return *this;
+        }
+
+        ~StencilIndexCaches() = default;
+
+        template <std::size_t stencil_size, std::size_t dim>
+        StencilIndexCache<Mesh, stencil_size>& get(const Stencil<stencil_size, dim>& stencil)
+        {
+            std::vector<int> key(stencil.begin(), stencil.end());
+
+            std::lock_guard lock(m_mutex);
+            auto& cache = m_caches[key];
+            if (!cache)
+            {
+                cache = std::make_shared<StencilIndexCache<Mesh, stencil_size>>();
+            }
+            return *std::static_pointer_cast<StencilIndexCache<Mesh, stencil_size>>(cache);
+        }
+
+        void clear()
+        {
+            std::lock_guard lock(m_mutex);
+            m_caches.clear();
+        }
+
+      private:
+
+        // The stencils of same offsets but of different sizes cannot have the same key
+        std::map<std::vector<int>, std::shared_ptr<void>> m_caches;
+        std::mutex m_mutex;
+    };
+
     template <class Mesh, std::size_t stencil_size_>
     class IteratorStencil
     {
@@ -582,6 +713,7 @@ namespace samurai
         const mesh_interval_t* m_mesh_interval = nullptr;
         const StencilAnalyzer<stencil_size, dim>& m_stencil_analyzer;
         std::array<cell_t, stencil_size> m_cells;
+        StencilIndexCache<Mesh, stencil_size>* m_cache = nullptr;
 
       public:
 
@@ -597,6 +729,20 @@ namespace samurai
                 cell.level        = mesh.min_level();
                 cell.length       = length;
             }
+
+            // The cache is only worth it if some cells of the stencil are looked up outside the row of the origin
+            if constexpr (requires { mesh.stencil_index_cache(stencil_analyzer.stencil); })
+            {
+                bool has_other_rows = false;
+                for (std::size_t i = 0; i < stencil_size; ++i)
+                {
+                    has_other_rows = has_other_rows || !m_stencil_analyzer.same_row_as_origin[i];
+                }
+                if (has_other_rows)
+                {
+                    m_cache = mesh.stencil_index_cache(stencil_analyzer.stencil);
+                }
+            }
         }
 
         void init(const mesh_interval_t& origin_mesh_interval)
@@ -619,6 +765,22 @@ namespace samurai
             {
                 origin_cell.indices[d + 1] = origin_mesh_interval.index[d];
             }
+
+            typename StencilIndexCache<Mesh, stencil_size>::indices_t cached_indices;
+            if (m_cache && m_cache->find(origin_mesh_interval, cached_indices))
+            {
+                for (unsigned int i = 0; i < stencil_size; ++i)
+                {
+                    cell_t& cell = m_cells[i];
+                    for (unsigned int k = 0; k < dim; ++k)
+                    {
+                        cell.indices[k] = origin_cell.indices[k] + m_stencil_analyzer.stencil(i, k);
+                    }
+                    cell.index = cached_indices[i];
+                }
+                return;
+            }
+
             origin_cell.index = get_index_start(m_mesh, origin_mesh_interval);
 #ifndef NDEBUG
             if (origin_cell.index > 0 && static_cast<std::size_t>(origin_cell.index) > m_mesh.nb_cells()) // nb_cells() is very costly
@@ -668,6 +830,15 @@ namespace samurai
                     }
                 }
             }
+
+            if (m_cache)
+            {
+                for (unsigned int i = 0; i < stencil_size; ++i)
+                {
+                    cached_indices[i] = m_cells[i].index;
+                }
+                m_cache->insert(origin_mesh_interval, cached_indices);
+            }
         }
 
         SAMURAI_INLINE const auto& mesh() const
@@ -54,6 +54,9 @@ namespace samurai
         using container_t                          = detail::eigen_type_t<value_t, size, SOA>;
         using size_type                            = Eigen::Index;
 
+        // true if the components of an item are contiguous in memory, false if the values of each component are contiguous
+        static constexpr bool contiguous_components = (size == 1);
+
         eigen_container() = default;
 
         explicit eigen_container(std::size_t dynamic_size)
@@ -46,6 +46,9 @@ namespace samurai
         using container_t = xt::xtensor<value_t, ((size == 1) && can_collapse) ? 1 : 2, detail::xtensor_layout_v<static_layout>>;
         using size_type   = std::size_t;
 
+        // true if the components of an item are contiguous in memory, false if the values of each component are contiguous
+        static constexpr bool contiguous_components = (size == 1) || !SOA;
+
         xtensor_container() = default;
 
         explicit xtensor_container(std::size_t dynamic_size)
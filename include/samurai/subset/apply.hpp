@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <vector>
+
+#include "../algorithm.hpp"
 #include "concepts.hpp"
+#include "interval_kernels.hpp"
 #include "utils.hpp"
 
 namespace samurai
@@ -38,9 +42,42 @@ namespace samurai
                 {
                     return func(interval, index);
                 };
+                if constexpr (requires { requires std::decay_t<Set>::has_interval_kernel; })
+                {
+                    if (global_set.operands_at_set_level())
+                    {
+                        return apply_interval_kernel(set, func_int);
+                    }
+                }
                 return apply(set, start_and_stop, func_int);
             }
         }
+
+        /**
+         * Coordinates of the rows of the outermost dimension covered by the set.
+         * The set is taken by copy, so that the traversal state of the caller is not modified.
+         */
+        template <class Set>
+        auto outer_coordinates(Set set)
+        {
+            constexpr std::size_t dim = Set::dim;
+            xt::xtensor_fixed<int, xt::xshape<dim - 1>> index;
+
+            std::vector<int> coordinates;
+            auto local_set      = set.template get_local_set<dim>(set.level(), index);
+            auto start_and_stop = set.template get_start_and_stop_function<dim>();
+            apply(local_set,
+                  start_and_stop,
+                  [&](const auto& interval)
+                  {
+                      for (auto i = interval.start; i < interval.end; ++i)
+                      {
+                          coordinates.push_back(i);
+                      }
+                      return false;
+                  });
+            return coordinates;
+        }
     }
 
     template <class Set, class Func>
@@ -61,6 +98,60 @@ namespace samurai
         }
     }
 
+    /**
+     * Same as apply(global_set, user_func), with Run::Parallel: the rows of the outermost dimension are distributed among the
+     * OpenMP threads, each of which traverses them with its own copy of the set (the traversal state is stored in the set).
+     * user_func is then called concurrently, so it must only write in the cells of the interval it receives, or in cells
+     * that no other row of the set writes in (as the projection, the prediction or the detail computation do).
+     * The traversal is sequential in 1D and without OpenMP.
+     */
+    template <Run run_type, class Set, class Func>
+    void apply(Set&& global_set, Func&& user_func)
+    {
+        using set_t               = std::decay_t<Set>;
+        constexpr std::size_t dim = set_t::dim;
+
+#ifdef SAMURAI_WITH_OPENMP
+        constexpr bool parallel = (run_type == Run::Parallel) && (dim > 1);
+#else
+        constexpr bool parallel = false;
+#endif
+        if constexpr (!parallel)
+        {
+            apply(std::forward<Set>(global_set), std::forward<Func>(user_func));
+        }
+        else
+        {
+            if (!global_set.exist())
+            {
+                return;
+            }
+
+            auto coordinates = detail::outer_coordinates<set_t>(global_set);
+
+#pragma omp parallel
+            {
+                set_t local_set(global_set);
+                xt::xtensor_fixed<int, xt::xshape<dim - 1>> index;
+                // sets the traversal state of the outermost dimension, from which the rows are found
+                local_set.template get_local_set<dim>(local_set.level(), index);
+
+                auto func = [&](const auto& interval, const auto& yz)
+                {
+                    user_func(interval, yz);
+                    return false;
+                };
+
+#pragma omp for schedule(dynamic)
+                for (std::size_t k = 0; k < coordinates.size(); ++k)
+                {
+                    index[dim - 2] = coordinates[k];
+                    detail::apply_impl<dim - 1>(local_set, func, index);
+                }
+            }
+        }
+    }
+
     template <class Set>
     bool empty_check(Set&& global_set)
     {
@@ -0,0 +1,124 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../level_cell_array.hpp"
+#include "node.hpp"
+
+namespace samurai
+{
+    /**
+     * Evaluates the set expression once and stores its intervals in a LevelCellArray at the level of the subset.
+     * Applying an operator on the result is then a scan of a flat list of intervals:
+     *
+     *     for_each_interval(materialize(set), op);
+     */
+    template <class Op, class StartEndOp, class... S>
+    auto materialize(Subset<Op, StartEndOp, S...> set)
+    {
+        using subset_t = Subset<Op, StartEndOp, S...>;
+        return LevelCellArray<subset_t::dim, typename subset_t::interval_t>(set);
+    }
+
+    /**
+     * Materialized subsets of a mesh, identified by a name given by the caller and by the level at which they are evaluated.
+     * A set is evaluated on its first request, and then returned as is until the cache is cleared:
+     * the name must therefore identify the whole expression, including the runtime values it depends on other than the level.
+     * It also stores named masks over the cell indices of the mesh (e.g. the leaves), built on their first request in the same way.
+     * The caches are not copied with the mesh, and must be cleared when the cells change.
+     */
+    template <class LCA>
+    class SubsetCache
+    {
+      public:
+
+        using lca_t = LCA;
+
+        SubsetCache() = default;
+
+        SubsetCache(const SubsetCache&)
+        {
+        }
+
+        SubsetCache& operator=(const SubsetCache&)
+        {
+            clear();
+            return *this;
+        }
+
+        ~SubsetCache() = default;
+
+        /**
+         * Returns the set named name at the given level, built with make_subset() if it is not in the cache.
+         * The reference remains valid until the cache is cleared.
+         * The name is only copied when the set is built: a lookup does not allocate.
+         */
+        template <class Func>
+        const lca_t& get(std::string_view name, std::size_t level, Func&& make_subset)
+        {
+            std::lock_guard lock(m_mutex);
+            auto sets = m_sets.find(name);
+            if (sets == m_sets.end())
+            {
+                sets = m_sets.emplace(std::string(name), std::map<std::size_t, lca_t>{}).first;
+            }
+            auto it = sets->second.find(level);
+            if (it == sets->second.end())
+            {
+                it = sets->second.emplace(level, lca_t(make_subset())).first;
+            }
+            return it->second;
+        }
+
+        /**
+         * Returns the mask of the cell indices named name, built with make_mask() if it is not in the cache.
+         * The reference remains valid until the cache is cleared.
+         */
+        template <class Func>
+        const std::vector<bool>& get_cell_mask(std::string_view name, Func&& make_mask)
+        {
+            std::lock_guard lock(m_mutex);
+            auto it = m_cell_masks.find(name);
+            if (it == m_cell_masks.end())
+            {
+                it = m_cell_masks.emplace(std::string(name), make_mask()).first;
+            }
+            return it->second;
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard lock(m_mutex);
+            std::size_t nb_sets = 0;
+            for (const auto& [name, sets] : m_sets)
+            {
+                nb_sets += sets.size();
+            }
+            return nb_sets + m_cell_masks.size();
+        }
+
+        void clear()
+        {
+            std::lock_guard lock(m_mutex);
+            m_sets.clear();
+            m_cell_masks.clear();
+        }
+
+      private:
+
+        // the transparent comparators allow the lookups by std::string_view
+        std::map<std::string, std::map<std::size_t, lca_t>, std::less<>> m_sets;
+        std::map<std::string, std::vector<bool>, std::less<>> m_cell_masks;
+        mutable std::mutex m_mutex;
+    };
+} // namespace samurai
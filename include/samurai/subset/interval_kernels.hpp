@@ -0,0 +1,224 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "visitor.hpp"
+
+namespace samurai::detail
+{
+    /**
+     * Returns the first interval of [first, last) whose end is greater than bound, the ends being increasing.
+     * With AVX2 (enabled by the CMake option SAMURAI_WITH_AVX2), the ends of 8 intervals are compared at once.
+     */
+    template <class interval_t>
+    SAMURAI_INLINE const interval_t* skip_ending_before(const interval_t* first, const interval_t* last, typename interval_t::value_t bound)
+    {
+#if defined(__AVX2__)
+        using value_t = typename interval_t::value_t;
+        if constexpr (std::is_same_v<value_t, int> && sizeof(interval_t) % sizeof(int) == 0)
+        {
+            constexpr int stride  = static_cast<int>(sizeof(interval_t) / sizeof(int));
+            const __m256i offsets = _mm256_setr_epi32(0, stride, 2 * stride, 3 * stride, 4 * stride, 5 * stride, 6 * stride, 7 * stride);
+            const __m256i vbound  = _mm256_set1_epi32(bound);
+            while (last - first >= 8)
+            {
+                __m256i ends = _mm256_i32gather_epi32(&first->end, offsets, sizeof(int));
+                auto mask    = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(ends, vbound))));
+                if (mask != 0)
+                {
+                    return first + std::countr_zero(mask);
+                }
+                first += 8;
+            }
+        }
+#endif
+        while (first != last && first->end <= bound)
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    /**
+     * Sends the computed intervals to func, merging those which overlap or touch, as the scan of SetTraverser does.
+     * As in apply(), func returns true to stop the traversal.
+     */
+    template <class interval_t, class Func>
+    class IntervalKernelOutput
+    {
+      public:
+
+        using value_t = typename interval_t::value_t;
+
+        explicit IntervalKernelOutput(Func& func)
+            : m_func(func)
+        {
+        }
+
+        SAMURAI_INLINE bool push(value_t start, value_t end)
+        {
+            if (m_has_pending && start <= m_pending.end)
+            {
+                m_pending.end = std::max(m_pending.end, end);
+                return false;
+            }
+            bool stop       = flush();
+            m_pending.start = start;
+            m_pending.end   = end;
+            m_has_pending   = true;
+            return stop;
+        }
+
+        SAMURAI_INLINE bool flush()
+        {
+            if (!m_has_pending)
+            {
+                return false;
+            }
+            m_has_pending = false;
+            return m_func(m_pending);
+        }
+
+      private:
+
+        Func& m_func;
+        interval_t m_pending;
+        bool m_has_pending = false;
+    };
+
+    /**
+     * Intersection of two sorted lists of disjoint intervals.
+     * The intervals ending before the current interval of the other list are skipped; the advance of the two lists is branch-free.
+     */
+    template <class interval_t, class Output>
+    bool intersection_kernel(const interval_t* a, const interval_t* a_last, const interval_t* b, const interval_t* b_last, Output& out)
+    {
+        while (a != a_last && b != b_last)
+        {
+            a = skip_ending_before(a, a_last, b->start);
+            if (a == a_last)
+            {
+                break;
+            }
+            b = skip_ending_before(b, b_last, a->start);
+            if (b == b_last)
+            {
+                break;
+            }
+            if (b->start >= a->end)
+            {
+                continue; // b was moved past a
+            }
+            // a and b overlap, since each one ends after the start of the other
+            if (out.push(std::max(a->start, b->start), std::min(a->end, b->end)))
+            {
+                return true;
+            }
+            auto a_end = a->end;
+            auto b_end = b->end;
+            a += (a_end <= b_end);
+            b += (b_end <= a_end);
+        }
+        return out.flush();
+    }
+
+    /**
+     * Union of two sorted lists of disjoint intervals.
+     */
+    template <class interval_t, class Output>
+    bool union_kernel(const interval_t* a, const interval_t* a_last, const interval_t* b, const interval_t* b_last, Output& out)
+    {
+        while (a != a_last || b != b_last)
+        {
+            bool take_a = (b == b_last) || (a != a_last && a->start <= b->start);
+            const interval_t* next = take_a ? a : b;
+            a += take_a;
+            b += !take_a;
+            if (out.push(next->start, next->end))
+            {
+                return true;
+            }
+        }
+        return out.flush();
+    }
+
+    /**
+     * Difference a \ b of two sorted lists of disjoint intervals.
+     */
+    template <class interval_t, class Output>
+    bool difference_kernel(const interval_t* a, const interval_t* a_last, const interval_t* b, const interval_t* b_last, Output& out)
+    {
+        for (; a != a_last; ++a)
+        {
+            auto start = a->start;
+            auto end   = a->end;
+
+            b = skip_ending_before(b, b_last, start);
+            while (b != b_last && b->start < end)
+            {
+                if (b->start > start && out.push(start, b->start))
+                {
+                    return true;
+                }
+                start = std::max(start, b->end);
+                if (b->end > end)
+                {
+                    break; // b may also cover the next intervals of a
+                }
+                ++b;
+            }
+            if (start < end && out.push(start, end))
+            {
+                return true;
+            }
+        }
+        return out.flush();
+    }
+
+    template <class container_t>
+    SAMURAI_INLINE auto interval_range(const IntervalListVisitor<container_t>& visitor)
+    {
+        return std::make_pair(std::to_address(visitor.begin()), std::to_address(visitor.end()));
+    }
+
+    /**
+     * Computes the row given by the traverser of a two-operand intersection, union or difference with the merge kernels,
+     * instead of the generic scan of apply(set, start_and_stop, func).
+     * The operands must be at the level of the set: their intervals are then used without transformation.
+     */
+    template <class Operator, class V1, class V2, class Func>
+    bool apply_interval_kernel(const SetTraverser<Operator, V1, V2>& set, Func&& func)
+    {
+        using interval_t = typename SetTraverser<Operator, V1, V2>::interval_t;
+
+        auto [a, a_last] = interval_range(std::get<0>(set.sets()));
+        auto [b, b_last] = interval_range(std::get<1>(set.sets()));
+
+        IntervalKernelOutput<interval_t, Func> out(func);
+        if constexpr (std::is_same_v<Operator, IntersectionOp>)
+        {
+            return intersection_kernel(a, a_last, b, b_last, out);
+        }
+        else if constexpr (std::is_same_v<Operator, UnionOp>)
+        {
+            return union_kernel(a, a_last, b, b_last, out);
+        }
+        else
+        {
+            static_assert(std::is_same_v<Operator, DifferenceOp>, "No interval kernel for this operator.");
+            return difference_kernel(a, a_last, b, b_last, out);
+        }
+    }
+} // namespace samurai::detail
@@ -25,6 +25,13 @@ namespace samurai
     template <class Set, class Func>
     void apply(Set&& global_set, Func&& func);
 
+    template <Run run_type, class Set, class Func>
+    void apply(Set&& global_set, Func&& func);
+
+    // LevelCellArray operand of a set expression (see Self)
+    template <class S>
+    concept IsSelfSet = requires(const S& s) { s.m_lca.level(); };
+
     template <class Op, class StartEndOp, class... S>
     class Subset
     {
@@ -34,6 +41,13 @@ namespace samurai
         using set_type                   = std::tuple<S...>;
         using interval_t                 = get_interval_t<S...>;
 
+        // Two-operand intersection, union or difference of LevelCellArrays, whose rows can be computed by the merge kernels
+        // of interval_kernels.hpp when operands_at_set_level() is true.
+        static constexpr bool has_interval_kernel = sizeof...(S) == 2 && (IsSelfSet<S> && ...)
+                                                 && std::is_same_v<StartEndOp, start_end_function<dim>>
+                                                 && (std::is_same_v<Op, IntersectionOp> || std::is_same_v<Op, UnionOp>
+                                                     || std::is_same_v<Op, DifferenceOp>);
+
         Subset(Op&& op, StartEndOp&& start_end_op, S&&... s)
             : m_operator(std::forward<Op>(op))
             , m_start_end_op(std::forward<StartEndOp>(start_end_op))
@@ -78,6 +92,19 @@ namespace samurai
             apply(*this, func);
         }
 
+        /**
+         * apply_op() with the given run type: see apply<Run::Parallel>() for the requirements on the operators.
+         */
+        template <Run run_type, class... ApplyOp>
+        void apply_op(ApplyOp&&... op)
+        {
+            auto func = [&](auto& interval, auto& index)
+            {
+                (op(m_level, interval, index), ...);
+            };
+            apply<run_type>(*this, func);
+        }
+
         SAMURAI_INLINE void to_stream(std::ostream& os)
         {
             apply_op(
@@ -175,6 +202,21 @@ namespace samurai
             return empty_check(*this);
         }
 
+        /**
+         * True if the set and its operands are all at the same level, so that the intervals of the operands are used
+         * without any transformation.
+         */
+        bool operands_at_set_level() const
+        {
+            return m_ref_level == m_level && m_min_level == m_level
+                && std::apply(
+                       [this](const auto&... args)
+                       {
+                           return ((args.m_lca.level() == m_level && args.level() == m_level && args.ref_level() == m_level) && ...);
+                       },
+                       m_s);
+        }
+
         bool exist() const
         {
             return std::apply(
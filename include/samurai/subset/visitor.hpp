@@ -131,6 +131,17 @@ namespace samurai
             return m_shift2dest;
         }
 
+        // Intervals of the list not visited yet
+        SAMURAI_INLINE auto begin() const
+        {
+            return m_first;
+        }
+
+        SAMURAI_INLINE auto end() const
+        {
+            return m_last;
+        }
+
         template <class StartEnd>
         SAMURAI_INLINE void next_interval(StartEnd& start_and_stop)
         {
@@ -249,6 +260,11 @@ namespace samurai
                 m_s);
         }
 
+        SAMURAI_INLINE const auto& sets() const
+        {
+            return m_s;
+        }
+
         template <class StartEnd>
         void next(auto scan, StartEnd&& start_and_stop)
         {
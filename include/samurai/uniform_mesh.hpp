@@ -63,6 +63,10 @@ namespace samurai
 
         const ca_type& operator[](mesh_id_t mesh_id) const;
 
+        MemoryHandle& memory_handle(mesh_id_t mesh_id) const;
+
+        std::size_t version() const;
+
         void swap(UniformMesh& mesh) noexcept;
 
         template <typename... T>
@@ -87,6 +91,10 @@ namespace samurai
         void renumbering();
 
         mesh_t m_cells;
+        std::size_t m_version = 0;
+
+        // Entries of the memory tracker of the mesh ids (see track_memory())
+        mutable std::array<MemoryHandle, mesh_t::size> m_memory_handles;
     };
 
     template <class Config>
@@ -138,6 +146,19 @@ namespace samurai
         return m_cells[mesh_id];
     }
 
+    template <class Config>
+    SAMURAI_INLINE MemoryHandle& UniformMesh<Config>::memory_handle(mesh_id_t mesh_id) const
+    {
+        return m_memory_handles[static_cast<std::size_t>(mesh_id)];
+    }
+
+    // Number identifying the cells of the mesh (see Mesh_base::version())
+    template <class Config>
+    SAMURAI_INLINE std::size_t UniformMesh<Config>::version() const
+    {
+        return m_version;
+    }
+
     template <class Config>
     template <typename... T>
     SAMURAI_INLINE auto UniformMesh<Config>::get_interval(std::size_t, const interval_t& interval, T... index) const -> const interval_t&
@@ -158,6 +179,7 @@ namespace samurai
     {
         using std::swap;
         swap(m_cells, mesh.m_cells);
+        swap(m_version, mesh.m_version);
     }
 
     template <class Config>
@@ -181,6 +203,7 @@ namespace samurai
     template <class Config>
     SAMURAI_INLINE void UniformMesh<Config>::renumbering()
     {
+        m_version = detail::new_mesh_version();
         m_cells[mesh_id_t::reference].update_index();
 
         for (std::size_t id = 0; id < static_cast<std::size_t>(mesh_id_t::count); ++id)
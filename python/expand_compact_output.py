@@ -0,0 +1,119 @@
+"""Expand a file saved with --compact-output (Hdf5Options::compact) into the explicit points/connectivity
+layout written by samurai::save, together with its XDMF file, so that it can be opened in ParaView or VisIt."""
+
+import argparse
+import os
+import xml.etree.ElementTree as ET
+
+import h5py
+import numpy as np
+
+TOPOLOGY = {1: "Polyline", 2: "Quadrilateral", 3: "Hexahedron"}
+ELEMENT = {
+    1: [[0], [1]],
+    2: [[0, 0], [1, 0], [1, 1], [0, 1]],
+    3: [[0, 0, 0], [1, 0, 0], [1, 1, 0], [0, 1, 0], [0, 0, 1], [1, 0, 1], [1, 1, 1], [0, 1, 1]],
+}
+
+
+def level_indices(level_group, dim):
+    """Integer coordinates of the cells of one level, in the order of samurai::for_each_cell."""
+    intervals = []
+    for d in range(dim):
+        name = f"dim/{d}/intervals"
+        intervals.append(level_group[name][:].reshape(-1, 2) if name in level_group else np.zeros((0, 2), dtype=int))
+    offsets = [None] + [level_group[f"dim/{d}/offsets"][:] for d in range(1, dim)]
+    # position of the first point of each interval among all the points of its dimension
+    first_point = [np.concatenate(([0], np.cumsum(iv[:, 1] - iv[:, 0]))) for iv in intervals]
+
+    cells = []
+
+    def recurse(d, first, last, coords):
+        for k in range(first, last):
+            start, end = intervals[d][k]
+            if d == 0:
+                for i in range(start, end):
+                    cells.append([i] + coords)
+            else:
+                for y in range(start, end):
+                    p = first_point[d][k] + y - start
+                    recurse(d - 1, offsets[d][p], offsets[d][p + 1], [y] + coords)
+
+    recurse(dim - 1, 0, len(intervals[dim - 1]), [])
+    return np.asarray(cells, dtype=np.int64).reshape(-1, dim)
+
+
+def expand_part(part, meta):
+    dim = int(meta["dim"][()])
+    origin = meta["origin_point"][:]
+    scaling_factor = float(meta["scaling_factor"][()])
+    element = np.asarray(ELEMENT[dim])
+
+    points = []
+    for level in range(int(meta["min_level"][()]), int(meta["max_level"][()]) + 1):
+        if f"cells/level/{level}" not in part:
+            continue
+        indices = level_indices(part[f"cells/level/{level}"], dim)
+        length = scaling_factor / (1 << level)
+        corners = origin + length * indices
+        points.append(corners[:, np.newaxis, :] + length * element[np.newaxis, :, :])
+
+    points = np.concatenate(points).reshape(-1, dim)
+    coords = np.zeros((points.shape[0], 3))
+    coords[:, :dim] = points
+    connectivity = np.arange(points.shape[0]).reshape(-1, 1 << dim)
+    return coords, connectivity
+
+
+def expand(input_name, output_name):
+    source = h5py.File(f"{input_name}.h5", "r")
+    target = h5py.File(f"{output_name}.h5", "w")
+
+    h5_name = os.path.basename(output_name)
+    xdmf = ET.Element("Xdmf")
+    domain = ET.SubElement(xdmf, "Domain")
+    collection = ET.SubElement(domain, "Grid", Name="samurai", GridType="Collection", CollectionType="Spatial")
+
+    meshes = []
+    source.visititems(lambda name, obj: meshes.append(name) if name.endswith("/cells") and "dim" in obj else None)
+
+    for mesh in meshes:
+        prefix = mesh[: -len("/cells")]
+        group = source[prefix]
+        meta = group["cells"]
+        parts = [prefix] if "level" in meta else [f"{prefix}/{k}" for k in group.keys() if k.startswith("rank_")]
+
+        for part_name in parts:
+            part = source[part_name]
+            coords, connectivity = expand_part(part, meta)
+            target[f"{part_name}/points"] = coords
+            target[f"{part_name}/connectivity"] = connectivity
+
+            dim = int(meta["dim"][()])
+            grid = ET.SubElement(collection, "Grid", Name=part_name.strip("/"))
+            topo = ET.SubElement(grid, "Topology", TopologyType=TOPOLOGY[dim], NumberOfElements=str(connectivity.shape[0]))
+            ET.SubElement(topo, "DataItem", Dimensions=str(connectivity.size), Format="HDF").text = (
+                f"{h5_name}.h5:/{part_name.strip('/')}/connectivity"
+            )
+            geom = ET.SubElement(grid, "Geometry", GeometryType="XYZ")
+            ET.SubElement(geom, "DataItem", Dimensions=str(coords.size), Format="HDF").text = (
+                f"{h5_name}.h5:/{part_name.strip('/')}/points"
+            )
+
+            if "fields" in part:
+                for field_name, data in part["fields"].items():
+                    target[f"{part_name}/fields/{field_name}"] = data[:]
+                    attribute = ET.SubElement(grid, "Attribute", Name=field_name, Center="Cell")
+                    ET.SubElement(attribute, "DataItem", Dimensions=str(data.shape[0]), Format="HDF").text = (
+                        f"{h5_name}.h5:/{part_name.strip('/')}/fields/{field_name}"
+                    )
+
+    ET.ElementTree(xdmf).write(f"{output_name}.xdmf")
+
+
+parser = argparse.ArgumentParser(description="Expand a samurai compact output into points and connectivity.")
+parser.add_argument("filename", type=str, help="compact hdf5 file without .h5 extension")
+parser.add_argument("--output", type=str, required=False, help="output file without extension (default: <filename>_expanded)")
+args = parser.parse_args()
+
+expand(args.filename, args.output if args.output else f"{args.filename}_expanded")
@@ -1,7 +1,10 @@
+#include <random>
+
 #include <gtest/gtest.h>
 
 #include <samurai/cell_array.hpp>
 #include <samurai/cell_list.hpp>
+#include <samurai/flat_cell_list.hpp>
 
 namespace samurai
 {
@@ -128,4 +131,42 @@ namespace samurai
         xt::xtensor_fixed<int, xt::xshape<2>> coords{1, 2};
         EXPECT_EQ(cell_array.get_cell(2, 2 * coords + 1), (cell_t(origin_point, scaling_factor, 2, 3, 5, 8)));
     }
+
+    TEST(cell_array, from_flat_cell_list)
+    {
+        constexpr size_t dim = 3;
+
+        CellList<dim> cell_list;
+        FlatCellList<dim> flat_cell_list;
+
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> coord(-40, 40);
+        std::uniform_int_distribution<int> length(0, 4);
+        for (std::size_t s = 0; s < 5000; ++s)
+        {
+            std::size_t level = 2 + s % 3;
+            int x             = coord(gen);
+            int y             = coord(gen) / 4;
+            int z             = coord(gen) / 8;
+            int l             = length(gen);
+            if (l == 0)
+            {
+                cell_list[level][{y, z}].add_point(x);
+                flat_cell_list[level][{y, z}].add_point(x);
+            }
+            else
+            {
+                cell_list[level][{y, z}].add_interval({x, x + l});
+                flat_cell_list[level][{y, z}].add_interval({x, x + l});
+            }
+        }
+
+        CellArray<dim> expected(cell_list);
+        CellArray<dim> cell_array(flat_cell_list);
+        EXPECT_EQ(cell_array, expected);
+        EXPECT_EQ(cell_array.nb_cells(), expected.nb_cells());
+
+        flat_cell_list.clear();
+        EXPECT_TRUE(CellArray<dim>(flat_cell_list).empty());
+    }
 }
@@ -286,3 +286,68 @@ def test_finite_volume_burgers_os(max_level, enable_flux_reconstruction, eps, co
     if enable_flux_reconstruction:
         cmd.append("--enable-max-level-flux")
     output = subprocess.run(cmd, check=True, capture_output=True)
+
+
+def read_final_fields(path, filename):
+    import h5py
+
+    fields = {}
+    with h5py.File(os.path.join(path, f"{filename}.h5"), "r") as f:
+
+        def visit(name, obj):
+            if isinstance(obj, h5py.Dataset) and "fields" in name:
+                fields[name] = obj[...]
+
+        f.visititems(visit)
+    return fields
+
+
+@pytest.mark.parametrize(
+    "exec, options",
+    [
+        (
+            "finite-volume-heat",
+            ["--init-sol=dirac", "--Tf=0.02", "--min-level=3", "--max-level=6"],
+        ),
+        # time-dependent Dirichlet boundary conditions, the solver being reused over the time steps on a uniform mesh
+        (
+            "finite-volume-heat",
+            [
+                "--init-sol=dirac",
+                "--dirichlet",
+                "--left=-1",
+                "--right=1",
+                "--Tf=0.06",
+                "--dt=0.01",
+                "--min-level=5",
+                "--max-level=5",
+            ],
+        ),
+        (
+            "finite-volume-heat-nonlinear",
+            ["--Tf=0.002", "--dt=0.001", "-snes_rtol", "1e-12", "-snes_atol", "1e-14"],
+        ),
+    ],
+)
+@pytest.mark.parametrize("matrix_free_pc", ["none", "assembled"])
+def test_finite_volume_demo_matrix_free(exec, options, matrix_free_pc, tmp_path):
+    """The matrix-free solvers (MATSHELL) give the solution of the assembled ones."""
+    executable = get_executable(Path("../build/demos/FiniteVolume/"), exec)
+    cmd = [executable, "--path", str(tmp_path), "--save-final-state-only"] + options
+
+    assembled_cmd = cmd + ["--filename", "assembled"]
+    assembled_cmd += ["-ksp_type", "preonly", "-pc_type", "lu"]
+    subprocess.run(assembled_cmd, check=True, capture_output=True)
+
+    matrix_free_cmd = cmd + ["--filename", "matrix_free", "--petsc-matrix-free"]
+    matrix_free_cmd += ["--petsc-matrix-free-pc", matrix_free_pc]
+    matrix_free_cmd += ["-ksp_type", "gmres", "-ksp_rtol", "1e-12"]
+    matrix_free_cmd += ["-pc_type", "none" if matrix_free_pc == "none" else "lu"]
+    subprocess.run(matrix_free_cmd, check=True, capture_output=True)
+
+    assembled = read_final_fields(tmp_path, "assembled")
+    matrix_free = read_final_fields(tmp_path, "matrix_free")
+    assert len(assembled) > 0
+    assert assembled.keys() == matrix_free.keys()
+    for name in assembled:
+        assert matrix_free[name] == pytest.approx(assembled[name], rel=1e-6, abs=1e-8)
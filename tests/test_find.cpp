@@ -1,7 +1,10 @@
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <samurai/box.hpp>
 #include <samurai/field.hpp>
+#include <samurai/level_cell_array.hpp>
 #include <samurai/mr/adapt.hpp>
 #include <samurai/mr/mesh.hpp>
 
@@ -37,4 +40,76 @@ namespace samurai
         EXPECT_TRUE(static_cast<std::size_t>(cell.index) < mesh.nb_cells());                      // cell index makes sense
         EXPECT_TRUE(xt::all(cell.corner() <= coords && coords <= (cell.corner() + cell.length))); // coords in cell
     }
+
+    TEST(find, outer_row_index)
+    {
+        static constexpr std::size_t dim = 3;
+        using lca_t                      = LevelCellArray<dim>;
+        using coord_t                    = xt::xtensor_fixed<int, xt::xshape<dim>>;
+
+        auto in_set = [](int i, int j, int k)
+        {
+            return (i + 2 * j + 3 * k + 100) % 7 < 4 && j % 5 != 0 && k != 3;
+        };
+
+        // the sparse array has a plane far from the others, so that the dense index is not built
+        for (bool sparse : {false, true})
+        {
+            std::vector<int> planes;
+            for (int k = -6; k < (sparse ? 1 : 6); ++k)
+            {
+                planes.push_back(k);
+            }
+            if (sparse)
+            {
+                planes.push_back(1000);
+            }
+
+            lca_t lca(4);
+            for (int k : planes)
+            {
+                for (int j = -10; j < 10; ++j)
+                {
+                    for (int i = -10; i < 10; ++i)
+                    {
+                        if (in_set(i, j, k))
+                        {
+                            lca.add_point_back(i, {j, k});
+                        }
+                    }
+                }
+            }
+            EXPECT_EQ(lca.outer_row_index() == nullptr, sparse);
+
+            for (int k = -8; k < 8; ++k)
+            {
+                for (int j = -12; j < 12; ++j)
+                {
+                    for (int i = -12; i < 12; ++i)
+                    {
+                        auto offset   = find(lca, coord_t{i, j, k});
+                        bool expected = i >= -10 && i < 10 && j >= -10 && j < 10 && k >= -6 && (k <= 0 || (!sparse && k < 6))
+                                     && in_set(i, j, k);
+                        ASSERT_EQ(offset != -1, expected);
+                        if (expected)
+                        {
+                            EXPECT_TRUE(lca[0][static_cast<std::size_t>(offset)].contains(i));
+                        }
+                    }
+                }
+            }
+        }
+
+        // the index is rebuilt when the array is modified
+        lca_t lca(2);
+        lca.add_interval_back({0, 4}, {0, 0});
+        EXPECT_EQ(find(lca, coord_t{1, 0, 2}), -1);
+        lca.add_interval_back({0, 4}, {0, 2});
+        EXPECT_EQ(find(lca, coord_t{1, 0, 2}), 1);
+
+        lca_t copy = lca;
+        EXPECT_EQ(find(copy, coord_t{3, 0, 2}), 1);
+        copy.clear();
+        EXPECT_EQ(find(copy, coord_t{3, 0, 2}), -1);
+    }
 }
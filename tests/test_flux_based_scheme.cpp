@@ -0,0 +1,54 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <samurai/algorithm/update.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+namespace samurai
+{
+    // The application overlapped with the ghost update must give the same result as the blocking application,
+    // including after an adaptation of the mesh (the mask of the leaves is then rebuilt).
+    TEST(flux_based_scheme, overlapped_apply)
+    {
+        static constexpr std::size_t dim = 2;
+
+        using box_t   = Box<double, dim>;
+        auto mesh_cfg = mesh_config<dim>().min_level(2).max_level(5);
+        auto mesh     = mra::make_mesh(box_t{xt::zeros<double>({dim}), xt::ones<double>({dim})}, mesh_cfg);
+        auto u        = make_scalar_field<double>("u",
+                                           mesh,
+                                           [](const auto& coords)
+                                           {
+                                               return std::exp(-50 * (std::pow(coords[0] - 0.4, 2) + std::pow(coords[1] - 0.6, 2)));
+                                           });
+        make_bc<Dirichlet<1>>(u, 0.);
+
+        auto conv           = make_convection_upwind<decltype(u)>();
+        auto explicit_conv  = make_explicit(conv);
+        auto MRadaptation   = make_MRAdapt(u);
+        std::size_t n_cells = 0;
+
+        for (double eps : {1e-2, 1e-4})
+        {
+            auto mra_config = samurai::mra_config().epsilon(eps);
+            MRadaptation(mra_config);
+            ASSERT_NE(mesh.nb_cells(), n_cells);
+            n_cells = mesh.nb_cells();
+
+            update_ghost_mr(u);
+            auto blocking = conv(u);
+
+            auto ghost_update = begin_update_ghosts(u);
+            auto overlapped   = explicit_conv.apply_to(u, ghost_update);
+
+            for_each_cell(mesh,
+                          [&](const auto& cell)
+                          {
+                              EXPECT_DOUBLE_EQ(overlapped[cell], blocking[cell]);
+                          });
+        }
+    }
+}
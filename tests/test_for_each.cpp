@@ -1,5 +1,10 @@
+#include <cmath>
+
 #include <gtest/gtest.h>
 #include <samurai/amr/mesh.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
 
 namespace samurai
 {
@@ -84,4 +89,112 @@ namespace samurai
                       });
         EXPECT_EQ(nb_cells, 2);
     }
+
+    TEST(set, coloured_parallel_for_each_meshinterval)
+    {
+        using lca_t           = LevelCellArray<3>;
+        using interval_t      = typename lca_t::interval_t;
+        using value_t         = typename interval_t::value_t;
+        using mesh_interval_t = MeshInterval<3, interval_t>;
+
+        std::size_t level = 2;
+        lca_t lca(level, Box<value_t, 3>({0, 0, 0}, {4, 4, 4}));
+        auto set = intersection(lca, lca);
+
+        // Each row is visited once, and the rows visited by the same pass are never adjacent
+        std::vector<std::array<value_t, 2>> rows;
+        for_each_meshinterval<mesh_interval_t, Run::ParallelColoured>(set,
+                                                                      [&](const auto& mesh_interval)
+                                                                      {
+#pragma omp critical
+                                                                          rows.push_back({mesh_interval.index[0], mesh_interval.index[1]});
+                                                                      });
+        EXPECT_EQ(rows.size(), 16u);
+
+        std::size_t n_rows_per_pass = 4;
+        for (std::size_t pass = 0; pass < 4; ++pass)
+        {
+            for (std::size_t k = pass * n_rows_per_pass; k < (pass + 1) * n_rows_per_pass; ++k)
+            {
+                EXPECT_EQ(static_cast<std::size_t>(rows[k][0] & 1), pass & 1);
+                EXPECT_EQ(static_cast<std::size_t>(rows[k][1] & 1), (pass >> 1) & 1);
+            }
+        }
+    }
+
+    void expect_near_cell_values(const auto& field, const auto& expected)
+    {
+        for_each_cell(field.mesh(),
+                      [&](const auto& cell)
+                      {
+                          EXPECT_NEAR(field[cell], expected[cell], 1e-10 * (1 + std::abs(expected[cell])));
+                      });
+    }
+
+    // The explicit flux-based schemes accumulate the fluxes with the coloured traversal of the interfaces:
+    // the result must be the one of a sequential accumulation, interface by interface, including across the level jumps.
+    TEST(set, coloured_flux_accumulation)
+    {
+        static constexpr std::size_t dim = 2;
+
+        using box_t   = Box<double, dim>;
+        auto mesh_cfg = mesh_config<dim>().min_level(2).max_level(6);
+        auto mesh     = mra::make_mesh(box_t{xt::zeros<double>({dim}), xt::ones<double>({dim})}, mesh_cfg);
+        auto u        = make_scalar_field<double>("u",
+                                           mesh,
+                                           [](const auto& coords)
+                                           {
+                                               return std::exp(-50 * (std::pow(coords[0] - 0.4, 2) + std::pow(coords[1] - 0.6, 2)));
+                                           });
+        make_bc<Dirichlet<1>>(u, 0.);
+        auto MRadaptation = make_MRAdapt(u);
+        auto mra_config   = samurai::mra_config().epsilon(1e-4);
+        MRadaptation(mra_config);
+        ASSERT_LT(mesh.min_level(), mesh.max_level());
+        update_ghost_mr(u);
+
+        // nonlinear scheme
+        auto conv       = make_convection_upwind<decltype(u)>();
+        auto coloured   = conv(u);
+        auto sequential = make_scalar_field<double>("sequential", mesh, 0.);
+        auto add_flux   = [&](const auto& cell, auto& contrib)
+        {
+            sequential[cell] += conv.flux_value_cmpnent(contrib, 0);
+        };
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            conv.template for_each_interior_interface<Run::Sequential, false>(d, u, add_flux);
+            if (conv.include_boundary_fluxes())
+            {
+                conv.template for_each_boundary_interface<Run::Sequential, false>(d, u, add_flux);
+            }
+        }
+        expect_near_cell_values(coloured, sequential);
+
+        // linear homogeneous scheme, applied by intervals, compared with the cell by cell coefficients
+        auto diff = make_diffusion_order2<decltype(u)>();
+        coloured  = diff(u);
+        sequential.fill(0);
+        auto add_interior_coeffs = [&](auto& interface_cells, auto& comput_cells, auto& left_cell_coeffs, auto& right_cell_coeffs)
+        {
+            for (std::size_t c = 0; c < comput_cells.size(); ++c)
+            {
+                sequential[interface_cells[0]] += diff.cell_coeff(left_cell_coeffs, c, 0, 0) * u[comput_cells[c]];
+                sequential[interface_cells[1]] += diff.cell_coeff(right_cell_coeffs, c, 0, 0) * u[comput_cells[c]];
+            }
+        };
+        auto add_boundary_coeffs = [&](auto& cell, auto& comput_cells, auto& coeffs)
+        {
+            for (std::size_t c = 0; c < comput_cells.size(); ++c)
+            {
+                sequential[cell] += diff.cell_coeff(coeffs, c, 0, 0) * u[comput_cells[c]];
+            }
+        };
+        diff.for_each_interior_interface_and_coeffs(u, add_interior_coeffs);
+        if (diff.include_boundary_fluxes())
+        {
+            diff.for_each_boundary_interface_and_coeffs(u, add_boundary_coeffs);
+        }
+        expect_near_cell_values(coloured, sequential);
+    }
 }
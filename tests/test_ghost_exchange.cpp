@@ -0,0 +1,189 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <samurai/algorithm/update.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+
+namespace samurai
+{
+    double ghost_exchange_function(const auto& coords, std::size_t component)
+    {
+        return std::sin(3 * coords[0]) * std::cos(2 * coords[1]) + static_cast<double>(component);
+    }
+
+    decltype(auto) component(auto& field, const auto& cell, std::size_t c)
+    {
+        if constexpr (std::decay_t<decltype(field)>::is_scalar)
+        {
+            return field[cell];
+        }
+        else
+        {
+            return field[cell][c];
+        }
+    }
+
+    auto make_ghost_exchange_mesh()
+    {
+        constexpr std::size_t dim = 2;
+
+        using box_t   = Box<double, dim>;
+        auto mesh_cfg = mesh_config<dim>().min_level(2).max_level(6);
+        auto mesh     = mra::make_mesh(box_t{xt::zeros<double>({dim}), xt::ones<double>({dim})}, mesh_cfg);
+
+        // the cells are refined around a front, so that the subdomains share cells at several levels
+        auto u = make_scalar_field<double>("u",
+                                           mesh,
+                                           [](const auto& coords)
+                                           {
+                                               return std::tanh(50 * (coords[0] + coords[1] - 1));
+                                           });
+        make_bc<Dirichlet<1>>(u, 0.);
+        auto MRadaptation = make_MRAdapt(u);
+        auto mra_config   = samurai::mra_config().epsilon(1e-3);
+        MRadaptation(mra_config);
+        return mesh;
+    }
+
+    void set_cell_values(auto& field)
+    {
+        using field_t = std::decay_t<decltype(field)>;
+
+        field.fill(0);
+        for_each_cell(field.mesh(),
+                      [&](const auto& cell)
+                      {
+                          for (std::size_t c = 0; c < field_t::n_comp; ++c)
+                          {
+                              component(field, cell, c) = ghost_exchange_function(cell.center(), c);
+                          }
+                      });
+    }
+
+    // The ghosts which are cells of a neighbouring subdomain must hold the values of these cells
+    void check_ghosts_of_neighbours(const auto& field)
+    {
+        using field_t   = std::decay_t<decltype(field)>;
+        using mesh_id_t = typename field_t::mesh_t::mesh_id_t;
+
+        const auto& mesh = field.mesh();
+        for (const auto& neighbour : mesh.mpi_neighbourhood())
+        {
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                auto ghosts = intersection(mesh[mesh_id_t::reference][level], neighbour.mesh[mesh_id_t::cells][level]);
+                for_each_cell(mesh,
+                              ghosts,
+                              [&](const auto& cell)
+                              {
+                                  for (std::size_t c = 0; c < field_t::n_comp; ++c)
+                                  {
+                                      EXPECT_DOUBLE_EQ(component(field, cell, c), ghost_exchange_function(cell.center(), c));
+                                  }
+                              });
+            }
+        }
+    }
+
+    // The precomputed exchange plans copy the values of the neighbouring cells, whatever the layout of the field
+    TEST(ghost_exchange, values_of_neighbours)
+    {
+        mpi::communicator world;
+        if (world.size() == 1)
+        {
+            GTEST_SKIP() << "run with several MPI processes";
+        }
+
+        auto mesh  = make_ghost_exchange_mesh();
+        auto u     = make_scalar_field<double>("u", mesh);
+        auto v_aos = make_vector_field<double, 3>("v_aos", mesh);
+        auto v_soa = make_vector_field<double, 3, true>("v_soa", mesh);
+
+        // level by level
+        set_cell_values(u);
+        set_cell_values(v_aos);
+        set_cell_values(v_soa);
+        for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+        {
+            update_ghost_subdomains(level, u);
+            update_ghost_subdomains(level, v_aos);
+            update_ghost_subdomains(level, v_soa);
+        }
+        check_ghosts_of_neighbours(u);
+        check_ghosts_of_neighbours(v_aos);
+        check_ghosts_of_neighbours(v_soa);
+
+        // all the levels at once, with the plans built by the previous exchanges
+        set_cell_values(u);
+        set_cell_values(v_aos);
+        set_cell_values(v_soa);
+        update_ghost_subdomains(u);
+        update_ghost_subdomains(v_aos);
+        update_ghost_subdomains(v_soa);
+        check_ghosts_of_neighbours(u);
+        check_ghosts_of_neighbours(v_aos);
+        check_ghosts_of_neighbours(v_soa);
+    }
+
+    void expect_same_values(const auto& field, const auto& expected)
+    {
+        using field_t   = std::decay_t<decltype(field)>;
+        using mesh_id_t = typename field_t::mesh_t::mesh_id_t;
+
+        for_each_cell(field.mesh()[mesh_id_t::reference],
+                      [&](const auto& cell)
+                      {
+                          for (std::size_t c = 0; c < field_t::n_comp; ++c)
+                          {
+                              EXPECT_EQ(component(field, cell, c), component(expected, cell, c));
+                          }
+                      });
+    }
+
+    // Fields with different numbers of components are packed in the same messages
+    TEST(ghost_exchange, several_fields)
+    {
+        mpi::communicator world;
+        if (world.size() == 1)
+        {
+            GTEST_SKIP() << "run with several MPI processes";
+        }
+
+        auto mesh = make_ghost_exchange_mesh();
+        auto u    = make_scalar_field<double>("u", mesh);
+        auto v    = make_vector_field<double, 3>("v", mesh);
+        auto u_1  = make_scalar_field<double>("u_1", mesh);
+        auto v_1  = make_vector_field<double, 3>("v_1", mesh);
+
+        // level by level
+        set_cell_values(u);
+        set_cell_values(v);
+        set_cell_values(u_1);
+        set_cell_values(v_1);
+        for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+        {
+            update_ghost_subdomains(level, u, v);
+            update_ghost_subdomains(level, u_1);
+            update_ghost_subdomains(level, v_1);
+        }
+        expect_same_values(u, u_1);
+        expect_same_values(v, v_1);
+        check_ghosts_of_neighbours(u);
+        check_ghosts_of_neighbours(v);
+
+        // all the levels at once
+        set_cell_values(u);
+        set_cell_values(v);
+        set_cell_values(u_1);
+        set_cell_values(v_1);
+        update_ghost_subdomains(v, u);
+        update_ghost_subdomains(u_1);
+        update_ghost_subdomains(v_1);
+        expect_same_values(u, u_1);
+        expect_same_values(v, v_1);
+        check_ghosts_of_neighbours(u);
+        check_ghosts_of_neighbours(v);
+    }
+}
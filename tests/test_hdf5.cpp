@@ -5,7 +5,9 @@
 #include <samurai/arguments.hpp>
 #include <samurai/box.hpp>
 #include <samurai/cell_array.hpp>
+#include <samurai/io/async_writer.hpp>
 #include <samurai/io/hdf5.hpp>
+#include <samurai/io/hdf5_time_series.hpp>
 #include <samurai/mr/mesh.hpp>
 #include <samurai/uniform_mesh.hpp>
 
@@ -99,4 +101,167 @@ namespace samurai
         args::save_debug_fields = true;
         test_save(mesh);
     }
+
+    TYPED_TEST(hdf5_test, compact_output)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        xt::xtensor_fixed<double, xt::xshape<dim>> min_corner;
+        xt::xtensor_fixed<double, xt::xshape<dim>> max_corner;
+        min_corner.fill(-1);
+        max_corner.fill(1);
+        Box<double, dim> box(min_corner, max_corner);
+        CellArray<dim> ca;
+        ca[4] = {4, box};
+
+        Hdf5Options<CellArray<dim>> options;
+        options.compact = true;
+        save(fs::current_path(), "test_compact_mesh", options, ca);
+
+        HighFive::File file("test_compact_mesh.h5", HighFive::File::ReadOnly);
+        EXPECT_FALSE(file.exist("/mesh/points"));
+        EXPECT_EQ(H5Easy::load<std::size_t>(file, "/mesh/cells/min_level"), 4);
+
+        auto intervals = H5Easy::load<std::vector<int>>(file, "/mesh/cells/level/4/dim/0/intervals");
+        std::vector<int> expected;
+        for (const auto& interval : ca[4][0])
+        {
+            expected.push_back(interval.start);
+            expected.push_back(interval.end);
+        }
+        EXPECT_EQ(intervals, expected);
+    }
+
+    TYPED_TEST(hdf5_test, reduced_precision_output)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using Config                     = UniformConfig<dim>;
+        using Mesh                       = UniformMesh<Config>;
+        xt::xtensor_fixed<double, xt::xshape<dim>> min_corner;
+        xt::xtensor_fixed<double, xt::xshape<dim>> max_corner;
+        min_corner.fill(-1);
+        max_corner.fill(1);
+        Box<double, dim> box(min_corner, max_corner);
+        Mesh uniform(box, 4);
+        auto u = make_scalar_field<double>("u", uniform, 0.1);
+
+        Hdf5Options<Mesh> options;
+        options.single_precision = true;
+        options.index32          = true;
+        options.compression      = 6;
+        options.chunk_size       = 10;
+        save(fs::current_path(), "test_reduced_precision", options, uniform, u);
+
+        HighFive::File file("test_reduced_precision.h5", HighFive::File::ReadOnly);
+        EXPECT_EQ(file.getDataSet("/mesh/points").getDataType(), HighFive::AtomicType<float>());
+        EXPECT_EQ(file.getDataSet("/mesh/connectivity").getDataType(), HighFive::AtomicType<std::uint32_t>());
+        EXPECT_EQ(file.getDataSet("/mesh/fields/u").getDataType(), HighFive::AtomicType<float>());
+
+        auto data = H5Easy::load<std::vector<float>>(file, "/mesh/fields/u");
+        EXPECT_EQ(data.size(), uniform.nb_cells(Mesh::mesh_id_t::cells));
+        for (auto value : data)
+        {
+            EXPECT_EQ(value, 0.1f);
+        }
+    }
+
+    TYPED_TEST(hdf5_test, time_series)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using Config                     = UniformConfig<dim>;
+        using Mesh                       = UniformMesh<Config>;
+        xt::xtensor_fixed<double, xt::xshape<dim>> min_corner;
+        xt::xtensor_fixed<double, xt::xshape<dim>> max_corner;
+        min_corner.fill(-1);
+        max_corner.fill(1);
+        Box<double, dim> box(min_corner, max_corner);
+        Mesh uniform(box, 4);
+        auto u = make_scalar_field<double>("u", uniform, 1.);
+
+        Hdf5StorageOptions storage;
+        storage.single_precision = true;
+        storage.index32          = true;
+        storage.compression      = 6;
+
+        {
+            auto series = make_hdf5_time_series(fs::current_path(), "test_time_series", uniform, storage);
+            for (std::size_t n = 0; n < 3; ++n)
+            {
+                series.save(0.1 * static_cast<double>(n), u);
+            }
+            EXPECT_EQ(series.nb_steps(), 3);
+            EXPECT_EQ(series.nb_geometries(), 1);
+        }
+
+        HighFive::File file("test_time_series.h5", HighFive::File::ReadOnly);
+        EXPECT_EQ(file.getDataSet("/geometry/0/points").getDataType(), HighFive::AtomicType<float>());
+        EXPECT_EQ(file.getDataSet("/geometry/0/connectivity").getDataType(), HighFive::AtomicType<std::uint32_t>());
+        EXPECT_EQ(file.getDataSet("/step/2/fields/u").getDataType(), HighFive::AtomicType<float>());
+    }
+
+    TYPED_TEST(hdf5_test, time_series_mesh_change)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using Config                     = UniformConfig<dim>;
+        using Mesh                       = UniformMesh<Config>;
+        xt::xtensor_fixed<double, xt::xshape<dim>> min_corner;
+        xt::xtensor_fixed<double, xt::xshape<dim>> max_corner;
+        min_corner.fill(-1);
+        max_corner.fill(1);
+        Box<double, dim> box(min_corner, max_corner);
+        Mesh uniform(box, 3);
+        auto u = make_scalar_field<double>("u", uniform, 1.);
+
+        auto series = make_hdf5_time_series(fs::current_path(), "test_time_series_mesh_change", uniform);
+        series.save(0., u);
+        series.save(0.1, u);
+
+        uniform = Mesh(box, 4);
+        u.resize();
+        u.fill(2.);
+        series.save(0.2, u);
+        series.save(0.3, u);
+
+        EXPECT_EQ(series.nb_steps(), 4);
+        EXPECT_EQ(series.nb_geometries(), 2);
+
+        pugi::xml_document doc;
+        ASSERT_TRUE(doc.load_file("test_time_series_mesh_change.xdmf"));
+        auto step_grid = [&](std::size_t step)
+        {
+            return doc.select_node(fmt::format("//Grid[@Name='step_{}']", step).c_str()).node();
+        };
+
+        // the new geometry is written with the first step after the change, and referenced by the next one
+        EXPECT_NE(std::string(step_grid(1).child("xi:include").attribute("xpointer").value()).find("'step_0'"), std::string::npos);
+        EXPECT_NE(std::string(step_grid(2).child("Topology").child("DataItem").text().get()).find("/geometry/1/connectivity"),
+                  std::string::npos);
+        EXPECT_NE(std::string(step_grid(3).child("xi:include").attribute("xpointer").value()).find("'step_2'"), std::string::npos);
+    }
+
+    TYPED_TEST(hdf5_test, async_save)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using Config                     = UniformConfig<dim>;
+        using Mesh                       = UniformMesh<Config>;
+        xt::xtensor_fixed<double, xt::xshape<dim>> min_corner;
+        xt::xtensor_fixed<double, xt::xshape<dim>> max_corner;
+        min_corner.fill(-1);
+        max_corner.fill(1);
+        Box<double, dim> box(min_corner, max_corner);
+        Mesh uniform(box, 4);
+        auto u = make_scalar_field<double>("u", uniform, 1.);
+
+        AsyncWriter writer;
+        async_save(writer, fs::current_path(), "test_async_save", uniform, u);
+        u.fill(2.); // the snapshot is written, not the current values
+        writer.wait();
+
+        HighFive::File file("test_async_save.h5", HighFive::File::ReadOnly);
+        auto data = H5Easy::load<std::vector<double>>(file, "/mesh/fields/u");
+        EXPECT_EQ(data.size(), uniform.nb_cells(Mesh::mesh_id_t::cells));
+        for (auto value : data)
+        {
+            EXPECT_EQ(value, 1.);
+        }
+    }
 }
@@ -0,0 +1,125 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <samurai/io/hdf5.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+
+namespace samurai
+{
+    template <class T>
+    auto concatenate_rank_datasets(const HighFive::File& file, const std::string& name, std::size_t size)
+    {
+        std::vector<T> data;
+        for (std::size_t r = 0; r < size; ++r)
+        {
+            auto path = fmt::format("/mesh/rank_{}/{}", r, name);
+            if (file.exist(path))
+            {
+                auto rank_data = H5Easy::load<std::vector<T>>(file, path);
+                data.insert(data.end(), rank_data.begin(), rank_data.end());
+            }
+        }
+        return data;
+    }
+
+    // The global datasets written by all the ranks hold the per-rank datasets one after the other, in the order of the ranks
+    TEST(hdf5_mpi, shared_datasets)
+    {
+        constexpr std::size_t dim = 2;
+
+        mpi::communicator world;
+        if (world.size() == 1)
+        {
+            GTEST_SKIP() << "run with several MPI processes";
+        }
+
+        using box_t   = Box<double, dim>;
+        auto mesh_cfg = mesh_config<dim>().min_level(2).max_level(6);
+        auto mesh     = mra::make_mesh(box_t{xt::zeros<double>({dim}), xt::ones<double>({dim})}, mesh_cfg);
+        using mesh_t  = decltype(mesh);
+
+        auto front = [](const auto& coords)
+        {
+            return std::tanh(50 * (coords[0] + coords[1] - 1));
+        };
+        auto u = make_scalar_field<double>("u", mesh, front);
+        make_bc<Dirichlet<1>>(u, 0.);
+        auto MRadaptation = make_MRAdapt(u);
+        auto mra_config   = samurai::mra_config().epsilon(1e-3);
+        MRadaptation(mra_config);
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          u[cell] = front(cell.center());
+                      });
+
+        Hdf5Options<mesh_t> options;
+        options.shared_datasets = false;
+        save(fs::current_path(), "test_hdf5_mpi_per_rank", options, mesh, u);
+        options.shared_datasets = true;
+        save(fs::current_path(), "test_hdf5_mpi_shared", options, mesh, u);
+        world.barrier();
+
+        if (world.rank() != 0)
+        {
+            return;
+        }
+
+        auto size = static_cast<std::size_t>(world.size());
+        HighFive::File per_rank("test_hdf5_mpi_per_rank.h5", HighFive::File::ReadOnly);
+        HighFive::File shared("test_hdf5_mpi_shared.h5", HighFive::File::ReadOnly);
+
+        auto values = H5Easy::load<std::vector<double>>(shared, "/mesh/fields/u");
+        EXPECT_EQ(values, concatenate_rank_datasets<double>(per_rank, "fields/u", size));
+
+        auto points = H5Easy::load<std::vector<std::vector<double>>>(shared, "/mesh/points");
+        EXPECT_EQ(points, concatenate_rank_datasets<std::vector<double>>(per_rank, "points", size));
+
+        // the point indices of each rank are shifted by the number of points of the previous ranks
+        auto connectivity = H5Easy::load<std::vector<std::vector<std::size_t>>>(shared, "/mesh/connectivity");
+        std::vector<std::vector<std::size_t>> rank_connectivity;
+        std::size_t n_points = 0;
+        for (std::size_t r = 0; r < size; ++r)
+        {
+            if (per_rank.exist(fmt::format("/mesh/rank_{}/points", r)))
+            {
+                auto cells = H5Easy::load<std::vector<std::vector<std::size_t>>>(per_rank, fmt::format("/mesh/rank_{}/connectivity", r));
+                for (auto& cell : cells)
+                {
+                    for (auto& index : cell)
+                    {
+                        index += n_points;
+                    }
+                    rank_connectivity.push_back(cell);
+                }
+                n_points += H5Easy::getShape(per_rank, fmt::format("/mesh/rank_{}/points", r))[0];
+            }
+        }
+        EXPECT_EQ(connectivity, rank_connectivity);
+
+        // a single grid refers to the global datasets, instead of a collection of one grid per rank
+        pugi::xml_document per_rank_doc;
+        ASSERT_TRUE(per_rank_doc.load_file("test_hdf5_mpi_per_rank.xdmf"));
+        auto collection = per_rank_doc.select_node("//Grid[@GridType='Collection']").node();
+        ASSERT_TRUE(collection);
+        std::size_t n_elements = 0;
+        for (auto subgrid : collection.children("Grid"))
+        {
+            n_elements += subgrid.child("Topology").attribute("NumberOfElements").as_ullong();
+            EXPECT_EQ(subgrid.child("Attribute").child("DataItem").attribute("Dimensions").as_ullong(),
+                      subgrid.child("Topology").attribute("NumberOfElements").as_ullong());
+        }
+
+        pugi::xml_document shared_doc;
+        ASSERT_TRUE(shared_doc.load_file("test_hdf5_mpi_shared.xdmf"));
+        EXPECT_FALSE(shared_doc.select_node("//Grid[@GridType='Collection']"));
+        auto grid = shared_doc.select_node("//Grid[@Name='mesh']").node();
+        ASSERT_TRUE(grid);
+        EXPECT_EQ(grid.child("Topology").attribute("NumberOfElements").as_ullong(), n_elements);
+        EXPECT_EQ(grid.child("Topology").attribute("NumberOfElements").as_ullong(), values.size());
+        EXPECT_EQ(grid.child("Attribute").child("DataItem").attribute("Dimensions").as_ullong(), values.size());
+        EXPECT_EQ(std::string(grid.child("Attribute").child("DataItem").text().get()), "test_hdf5_mpi_shared.h5:/mesh/fields/u");
+    }
+}
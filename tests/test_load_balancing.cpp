@@ -0,0 +1,129 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <samurai/algorithm/update.hpp>
+#include <samurai/load_balancing.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+
+namespace samurai
+{
+    template <class Field>
+    auto global_cell_count_and_sum(const Field& u)
+    {
+        using mesh_id_t = typename Field::mesh_t::mesh_id_t;
+
+        mpi::communicator world;
+        std::size_t n_cells = u.mesh().nb_cells(mesh_id_t::cells);
+        double sum          = 0;
+        for_each_cell(u.mesh()[mesh_id_t::cells],
+                      [&](const auto& cell)
+                      {
+                          sum += u[cell] * std::pow(cell.length, Field::dim);
+                      });
+        return std::make_pair(mpi::all_reduce(world, n_cells, std::plus<std::size_t>()), mpi::all_reduce(world, sum, std::plus<double>()));
+    }
+
+    // The cells are refined around a bump located in the subdomain of the first rank, then migrated.
+    template <class Checker>
+    void load_balance_bump(Partitioning partitioning, double threshold, Checker&& check_imbalance)
+    {
+        static constexpr std::size_t dim = 2;
+
+        mpi::communicator world;
+        if (world.size() == 1)
+        {
+            GTEST_SKIP() << "run with several MPI processes";
+        }
+
+        auto bump = [](const auto& coords)
+        {
+            return std::exp(-200 * (std::pow(coords[0] - 0.15, 2) + std::pow(coords[1] - 0.15, 2)));
+        };
+
+        using box_t     = Box<double, dim>;
+        auto mesh_cfg   = mesh_config<dim>().min_level(2).max_level(7).partitioning(partitioning);
+        auto mesh       = mra::make_mesh(box_t{xt::zeros<double>({dim}), xt::ones<double>({dim})}, mesh_cfg);
+        using mesh_id_t = typename decltype(mesh)::mesh_id_t;
+
+        auto u = make_scalar_field<double>("u", mesh, bump);
+        make_bc<Dirichlet<1>>(u, 0.);
+
+        // the rebalancing after the adaptation is disabled, so that the mesh stays unbalanced
+        auto MRadaptation = make_MRAdapt(u);
+        MRadaptation.load_balancing().frequency(0);
+        auto mra_config = samurai::mra_config().epsilon(1e-4);
+        MRadaptation(mra_config);
+
+        // the migrated values can then be compared with the function
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          u[cell] = bump(cell.center());
+                      });
+
+        load_balancing_config lb_config;
+        lb_config.imbalance_threshold(threshold);
+        double imbalance = mesh.load_imbalance();
+        ASSERT_GT(imbalance, threshold);
+
+        auto [n_cells, sum] = global_cell_count_and_sum(u);
+        EXPECT_TRUE(load_balance(lb_config, u));
+
+        auto [new_n_cells, new_sum] = global_cell_count_and_sum(u);
+        EXPECT_EQ(new_n_cells, n_cells);
+        EXPECT_NEAR(new_sum, sum, 1e-12 * std::abs(sum));
+        check_imbalance(imbalance, mesh.load_imbalance());
+
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          EXPECT_DOUBLE_EQ(u[cell], bump(cell.center()));
+                      });
+
+        // The ghosts which are cells of a neighbouring subdomain receive their values
+        update_ghost_mr(u);
+        for (const auto& neighbour : mesh.mpi_neighbourhood())
+        {
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                auto own_cells = intersection(mesh[mesh_id_t::cells][level], neighbour.mesh[mesh_id_t::cells][level]);
+                EXPECT_TRUE(own_cells.empty());
+
+                auto ghosts = intersection(mesh[mesh_id_t::reference][level], neighbour.mesh[mesh_id_t::cells][level]);
+                for_each_cell(mesh,
+                              ghosts,
+                              [&](const auto& cell)
+                              {
+                                  EXPECT_DOUBLE_EQ(u[cell], bump(cell.center()));
+                              });
+            }
+        }
+    }
+
+    TEST(load_balancing, space_filling_curves)
+    {
+        double threshold = 0.05;
+        for (auto partitioning : {Partitioning::Morton, Partitioning::Hilbert})
+        {
+            load_balance_bump(partitioning,
+                              threshold,
+                              [&](double, double imbalance)
+                              {
+                                  EXPECT_LE(imbalance, threshold);
+                              });
+        }
+    }
+
+    // The diffusion only moves cells towards the neighbouring subdomains: the imbalance decreases at each call
+    TEST(load_balancing, diffusion)
+    {
+        load_balance_bump(Partitioning::Intervals,
+                          0.05,
+                          [](double imbalance_before, double imbalance)
+                          {
+                              EXPECT_LT(imbalance, imbalance_before);
+                          });
+    }
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <samurai/algorithm/update.hpp>
+#include <samurai/amr/mesh.hpp>
+#include <samurai/box.hpp>
+#include <samurai/field.hpp>
+#include <samurai/memory.hpp>
+#include <samurai/memory_tracker.hpp>
+#include <samurai/mr/mesh.hpp>
+
+namespace samurai
+{
+    TEST(memory, tracker_peak)
+    {
+        MemoryTracker tracker;
+        int u_1, u_2, v, A; // owners of the entries
+        tracker.update(&u_1, "fields", "u", 300);
+        tracker.update(&v, "fields", "v", 100);
+        tracker.update(&u_1, "fields", "u", 200);
+        tracker.update(&u_2, "fields", "u", 50); // same name, other object
+        tracker.update(&A, "PETSc", "A", 50);
+
+        auto entries = tracker.entries();
+        ASSERT_EQ(entries.size(), 3);
+
+        // the entries are sorted by subsystem, then by name
+        EXPECT_EQ(entries[0].subsystem, "PETSc");
+        EXPECT_EQ(entries[1].name, "u");
+        EXPECT_EQ(entries[1].usage.current, 250);
+        EXPECT_EQ(entries[1].usage.peak, 300);
+
+        auto total = tracker.total();
+        EXPECT_EQ(total.current, 400);
+        EXPECT_EQ(total.peak, 400);
+
+        // the peaks are kept when an object is released
+        tracker.release(&u_1);
+        entries = tracker.entries();
+        EXPECT_EQ(entries[1].usage.current, 50);
+        EXPECT_EQ(entries[1].usage.peak, 300);
+        EXPECT_EQ(tracker.total().current, 200);
+        EXPECT_EQ(tracker.total().peak, 400);
+
+        tracker.clear();
+        EXPECT_TRUE(tracker.entries().empty());
+        EXPECT_EQ(tracker.total().peak, 0);
+    }
+
+    TEST(memory, field)
+    {
+        static constexpr std::size_t dim = 2;
+        using box_t                      = Box<double, dim>;
+
+        auto mesh_cfg = mesh_config<dim>().min_level(2).max_level(4);
+        auto mesh     = mra::make_mesh(box_t{xt::zeros<double>({dim}), xt::ones<double>({dim})}, mesh_cfg);
+        auto u        = make_scalar_field<double>("u", mesh);
+        auto v        = make_vector_field<float, 3>("v", mesh);
+
+        using mesh_id_t = typename decltype(mesh)::mesh_id_t;
+        EXPECT_EQ(memory_usage(u), mesh.nb_cells() * sizeof(double));
+        EXPECT_EQ(memory_usage(v), 3 * mesh.nb_cells() * sizeof(float));
+        EXPECT_GT(mesh.nb_cells(), mesh.nb_cells(mesh_id_t::cells));
+
+        memory_tracker().clear();
+        track_memory(mesh, u, v);
+        std::size_t n_mesh_entries = 0;
+        for (const auto& e : memory_tracker().entries())
+        {
+            if (e.subsystem == "mesh")
+            {
+                ++n_mesh_entries;
+            }
+        }
+        EXPECT_EQ(n_mesh_entries, static_cast<std::size_t>(mesh_id_t::count));
+        EXPECT_EQ(memory_tracker().total().current, memory_usage(mesh) + memory_usage(u) + memory_usage(v));
+
+        // a field with the same name is added to the entry, and released with the field
+        {
+            auto w = make_scalar_field<double>("u", mesh);
+            track_memory(mesh, w);
+            EXPECT_EQ(memory_tracker().total().current, memory_usage(mesh) + 2 * memory_usage(u) + memory_usage(v));
+        }
+        EXPECT_EQ(memory_tracker().total().current, memory_usage(mesh) + memory_usage(u) + memory_usage(v));
+    }
+
+    // The old and the new mesh and fields coexist during the update of the mesh: the peak must hold both of them
+    TEST(memory, peak_of_mesh_update)
+    {
+        static constexpr std::size_t dim = 2;
+        using box_t                      = Box<double, dim>;
+
+        auto mesh_cfg = mesh_config<dim>().min_level(2).max_level(4).start_level(2);
+        auto mesh     = amr::make_mesh(box_t{xt::zeros<double>({dim}), xt::ones<double>({dim})}, mesh_cfg);
+        auto u        = make_scalar_field<double>("u", mesh, 1.);
+        auto tag      = make_scalar_field<int>("tag", mesh);
+        tag.fill(static_cast<int>(CellFlag::refine));
+
+        memory_tracker().clear();
+        track_memory(mesh, u);
+        std::size_t before = memory_tracker().total().current;
+
+        EXPECT_FALSE(update_field(tag, u));
+        EXPECT_EQ(memory_tracker().total().current, memory_usage(mesh) + memory_usage(u));
+        EXPECT_GE(memory_tracker().total().peak, before + memory_usage(mesh) + memory_usage(u));
+    }
+}
@@ -84,6 +84,61 @@ namespace samurai
         adapt(mra_config);
     }
 
+    // The mesh built from new cells and the mesh before adaptation, whose unchanged levels are reused,
+    // must be the mesh built from scratch.
+    TEST(MRA, mesh_from_reference_mesh)
+    {
+        constexpr std::size_t dim = 2;
+        auto box                  = samurai::Box<double, dim>({0., 0.}, {1., 1.});
+        auto mesh_cfg             = mesh_config<dim>().min_level(2).max_level(6);
+
+        // adapted mesh for a disk centred at (x_center, 0.3)
+        auto adapted_mesh = [&](double x_center)
+        {
+            auto mesh = mra::make_mesh(box, mesh_cfg);
+            auto u    = samurai::make_scalar_field<double>("u", mesh);
+            samurai::for_each_cell(mesh,
+                                   [&](auto& cell)
+                                   {
+                                       auto center = cell.center();
+                                       double dx   = center[0] - x_center;
+                                       double dy   = center[1] - 0.3;
+                                       u[cell]     = (dx * dx + dy * dy <= 0.04) ? 1. : 0.;
+                                   });
+            samurai::make_bc<samurai::Dirichlet<1>>(u, 0.);
+            auto adapt      = samurai::make_MRAdapt(u);
+            auto mra_config = samurai::mra_config().epsilon(1e-3);
+            adapt(mra_config);
+            return mesh;
+        };
+
+        auto old_mesh = adapted_mesh(0.3);
+        auto new_mesh = adapted_mesh(0.3 + 1. / 64); // the disk is moved by one cell of the finest level
+
+        using mesh_t    = decltype(old_mesh);
+        using mesh_id_t = typename mesh_t::mesh_id_t;
+
+        const auto& new_ca = new_mesh[mesh_id_t::cells];
+        EXPECT_FALSE(new_ca == old_mesh[mesh_id_t::cells]);
+
+        mesh_t from_reference{new_ca, old_mesh};
+        mesh_t from_scratch{new_ca, old_mesh.cfg()};
+        for (std::size_t i = 0; i < static_cast<std::size_t>(mesh_id_t::count); ++i)
+        {
+            auto id = static_cast<mesh_id_t>(i);
+            EXPECT_TRUE(from_reference[id] == from_scratch[id]) << "mesh id " << fmt::format("{}", id);
+        }
+        EXPECT_TRUE(from_reference.get_union() == from_scratch.get_union());
+
+        // all the levels unchanged
+        mesh_t same{old_mesh[mesh_id_t::cells], old_mesh};
+        for (std::size_t i = 0; i < static_cast<std::size_t>(mesh_id_t::count); ++i)
+        {
+            auto id = static_cast<mesh_id_t>(i);
+            EXPECT_TRUE(same[id] == old_mesh[id]) << "mesh id " << fmt::format("{}", id);
+        }
+    }
+
     TEST(MRA, scalar)
     {
         scalar_test(true);
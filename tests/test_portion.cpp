@@ -55,4 +55,31 @@ namespace samurai
         auto p = portion<1>(u, 5, 4, std::make_tuple(interval_t{2, 3}, 2, 2), std::make_tuple(0, 0, 0));
         EXPECT_EQ(p[0], 3 * ((2 << 4) + .5) / (1 << 9));
     }
+
+    TEST(portion, prediction_coefficients)
+    {
+        for (std::size_t delta_l = 0; delta_l < 4; ++delta_l)
+        {
+            const auto& table = prediction_coefficients<1, 2>(delta_l);
+
+            int nb_cells = 1 << delta_l;
+            for (int jj = 0; jj < nb_cells; ++jj)
+            {
+                for (int ii = 0; ii < nb_cells; ++ii)
+                {
+                    const auto& pred  = prediction<1>(delta_l, ii, jj);
+                    auto coefficients = table(ii, jj);
+                    EXPECT_EQ(coefficients.size(), pred.coeff.size());
+
+                    double sum = 0;
+                    for (const auto& [offset, c] : coefficients)
+                    {
+                        EXPECT_EQ(c, pred.coeff.at(offset));
+                        sum += c;
+                    }
+                    EXPECT_NEAR(sum, 1., 1e-12);
+                }
+            }
+        }
+    }
 }
@@ -0,0 +1,194 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <samurai/profiling.hpp>
+#include <samurai/timers.hpp>
+
+namespace samurai
+{
+    namespace
+    {
+        void inner_region()
+        {
+            SAMURAI_PROFILE_REGION("test inner");
+        }
+
+        void outer_region()
+        {
+            SAMURAI_PROFILE_REGION("test outer");
+            inner_region();
+            inner_region();
+        }
+
+        const profiling::RegionSummary* find_region(const std::vector<profiling::RegionSummary>& regions, const std::string& path)
+        {
+            for (const auto& r : regions)
+            {
+                if (r.path == path)
+                {
+                    return &r;
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    TEST(profiling, nesting)
+    {
+        auto& profiler = profiling::profiler();
+        profiler.clear();
+
+        outer_region();
+        outer_region();
+        inner_region();
+
+        auto regions = profiler.summary();
+
+        const auto* outer = find_region(regions, "test outer");
+        ASSERT_NE(outer, nullptr);
+        EXPECT_EQ(outer->depth, 0);
+        EXPECT_EQ(outer->calls, 2);
+
+        const auto* nested = find_region(regions, "test outer/test inner");
+        ASSERT_NE(nested, nullptr);
+        EXPECT_EQ(nested->depth, 1);
+        EXPECT_EQ(nested->calls, 4);
+        EXPECT_LE(nested->elapsed, outer->elapsed);
+        EXPECT_DOUBLE_EQ(outer->self, outer->elapsed - nested->elapsed);
+
+        // the inner region called outside of the outer one is a different node of the tree
+        const auto* inner = find_region(regions, "test inner");
+        ASSERT_NE(inner, nullptr);
+        EXPECT_EQ(inner->depth, 0);
+        EXPECT_EQ(inner->calls, 1);
+    }
+
+    TEST(profiling, threads)
+    {
+        auto& profiler = profiling::profiler();
+        profiler.clear();
+
+        std::thread t(outer_region);
+        t.join();
+        inner_region();
+
+        auto regions = profiler.summary();
+
+        const auto* outer = find_region(regions, "test outer");
+        ASSERT_NE(outer, nullptr);
+        const auto* inner = find_region(regions, "test inner");
+        ASSERT_NE(inner, nullptr);
+        EXPECT_NE(outer->thread, inner->thread);
+    }
+
+    TEST(profiling, timers)
+    {
+        profiling::profiler().clear();
+
+        times::timers.start("test timer");
+        outer_region();
+        times::timers.stop("test timer");
+
+        auto regions = profiling::profiler().summary();
+        EXPECT_NE(find_region(regions, "test timer/test outer/test inner"), nullptr);
+        EXPECT_GE(times::timers.getElapsedTime("test timer"), times::timers.getElapsedTime("test outer"));
+    }
+
+    TEST(profiling, overlapping_timers)
+    {
+        profiling::profiler().clear();
+
+        times::timers.start("test timer a");
+        times::timers.start("test timer b");
+        outer_region();
+        times::timers.stop("test timer a");
+        outer_region();
+        times::timers.stop("test timer b");
+
+        auto regions = profiling::profiler().summary();
+
+        // b is continued outside of a once a is stopped
+        const auto* b_in_a = find_region(regions, "test timer a/test timer b");
+        ASSERT_NE(b_in_a, nullptr);
+        const auto* b = find_region(regions, "test timer b");
+        ASSERT_NE(b, nullptr);
+        EXPECT_EQ(b_in_a->calls + b->calls, 1);
+        EXPECT_NE(find_region(regions, "test timer b/test outer"), nullptr);
+
+        const auto* a = find_region(regions, "test timer a");
+        ASSERT_NE(a, nullptr);
+        EXPECT_GE(a->elapsed, b_in_a->elapsed);
+        EXPECT_GE(times::timers.getElapsedTime("test timer b"), times::timers.getElapsedTime("test outer"));
+    }
+
+    TEST(profiling, bytes)
+    {
+        if constexpr (!profiling::PerfCounters::enabled)
+        {
+            GTEST_SKIP() << "SAMURAI_WITH_PERF_COUNTERS is not enabled";
+        }
+
+        auto& profiler = profiling::profiler();
+        profiler.clear();
+
+        {
+            SAMURAI_PROFILE_REGION("test bytes");
+            profiling::add_bytes(1000);
+            inner_region();
+            profiling::add_bytes(24);
+        }
+
+        auto regions = profiler.summary();
+        const auto* region = find_region(regions, "test bytes");
+        ASSERT_NE(region, nullptr);
+        EXPECT_EQ(region->bytes, 1024);
+        EXPECT_EQ(find_region(regions, "test bytes/test inner")->bytes, 0);
+
+        // without hardware counters (e.g. in a virtual machine), the values stay to 0
+        if (!profiler.counters_available())
+        {
+            EXPECT_EQ(region->counters.cycles, 0);
+            EXPECT_EQ(region->counters.instructions, 0);
+        }
+    }
+
+    TEST(profiling, trace)
+    {
+        auto& profiler = profiling::profiler();
+        profiler.clear();
+        profiler.enable_trace();
+
+        outer_region();
+
+        profiler.enable_trace(false);
+        inner_region(); // not recorded
+
+        auto filename = std::filesystem::temp_directory_path() / "samurai_test_trace.json";
+        profiler.save_trace(filename);
+
+        std::ifstream file(filename);
+        std::stringstream content;
+        content << file.rdbuf();
+        auto trace = content.str();
+
+        auto count = [&](const std::string& s)
+        {
+            std::size_t n = 0;
+            for (auto pos = trace.find(s); pos != std::string::npos; pos = trace.find(s, pos + 1))
+            {
+                ++n;
+            }
+            return n;
+        };
+        EXPECT_EQ(trace.find("{\"displayTimeUnit\""), 0);
+        EXPECT_EQ(count("\"name\": \"test outer\""), 1);
+        EXPECT_EQ(count("\"name\": \"test inner\""), 2);
+
+        profiler.clear();
+        std::filesystem::remove(filename);
+    }
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <samurai/sfc.hpp>
+
+namespace samurai
+{
+    TEST(sfc, morton_2d)
+    {
+        // Z-order on a 2x2 grid: (0,0), (0,1), (1,0), (1,1) with x the most significant bit
+        EXPECT_EQ(sfc::morton_key<2>({0, 0}, 1), 0);
+        EXPECT_EQ(sfc::morton_key<2>({0, 1}, 1), 1);
+        EXPECT_EQ(sfc::morton_key<2>({1, 0}, 1), 2);
+        EXPECT_EQ(sfc::morton_key<2>({1, 1}, 1), 3);
+        EXPECT_EQ(sfc::morton_key<2>({3, 0}, 2), 10);
+    }
+
+    TEST(sfc, hilbert_1d)
+    {
+        for (std::uint64_t i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(sfc::hilbert_key<1>({i}, 4), i);
+        }
+    }
+
+    template <std::size_t dim>
+    void check_hilbert_continuity(std::size_t n_bits)
+    {
+        const std::uint64_t n = std::uint64_t{1} << n_bits;
+
+        std::uint64_t n_points = 1;
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            n_points *= n;
+        }
+
+        std::vector<std::array<std::uint64_t, dim>> curve(n_points);
+        std::set<std::uint64_t> keys;
+        for (std::uint64_t p = 0; p < n_points; ++p)
+        {
+            std::array<std::uint64_t, dim> coords;
+            auto q = p;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                coords[d] = q % n;
+                q /= n;
+            }
+            auto key = sfc::hilbert_key<dim>(coords, n_bits);
+            ASSERT_LT(key, n_points);
+            keys.insert(key);
+            curve[key] = coords;
+        }
+        // The keys are a permutation of [0, n_points)
+        EXPECT_EQ(keys.size(), n_points);
+
+        // Two consecutive points along the curve are neighbours
+        for (std::size_t k = 1; k < curve.size(); ++k)
+        {
+            std::uint64_t distance = 0;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                distance += (curve[k][d] > curve[k - 1][d]) ? curve[k][d] - curve[k - 1][d] : curve[k - 1][d] - curve[k][d];
+            }
+            EXPECT_EQ(distance, 1);
+        }
+    }
+
+    TEST(sfc, hilbert_2d)
+    {
+        check_hilbert_continuity<2>(4);
+    }
+
+    TEST(sfc, hilbert_3d)
+    {
+        check_hilbert_continuity<3>(3);
+    }
+
+    TEST(sfc, partitioning_from_string)
+    {
+        EXPECT_EQ(partitioning_from_string("intervals"), Partitioning::Intervals);
+        EXPECT_EQ(partitioning_from_string("morton"), Partitioning::Morton);
+        EXPECT_EQ(partitioning_from_string("hilbert"), Partitioning::Hilbert);
+    }
+}
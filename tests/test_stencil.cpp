@@ -44,4 +44,44 @@ namespace samurai
                 EXPECT_EQ(rotated_dir, direction);
             });
     }
+
+    TYPED_TEST(stencil_test, stencil_index_cache)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using box_t                      = Box<double, dim>;
+
+        box_t box{xt::zeros<double>({dim}), xt::ones<double>({dim})};
+        auto mesh        = mra::make_mesh(box, mesh_config<dim>().min_level(2).max_level(4));
+        auto cached_mesh = mra::make_mesh(box, mesh_config<dim>().min_level(2).max_level(4).cache_stencil_indices(true));
+
+        auto stencil           = make_stencil_analyzer(star_stencil<dim, 2>());
+        auto stencil_it        = make_stencil_iterator(mesh, stencil);
+        auto cached_stencil_it = make_stencil_iterator(cached_mesh, stencil);
+
+        // The second pass reads the indices from the cache
+        for (std::size_t pass = 0; pass < 2; ++pass)
+        {
+            for_each_level(mesh,
+                           [&](std::size_t level)
+                           {
+                               for_each_meshinterval(mesh[MRMeshId::cells][level],
+                                                     [&](auto mesh_interval)
+                                                     {
+                                                         stencil_it.init(mesh_interval);
+                                                         cached_stencil_it.init(mesh_interval);
+                                                         for (std::size_t i = 0; i < stencil_it.cells().size(); ++i)
+                                                         {
+                                                             EXPECT_EQ(stencil_it.cells()[i].index, cached_stencil_it.cells()[i].index);
+                                                             EXPECT_EQ(stencil_it.cells()[i].indices, cached_stencil_it.cells()[i].indices);
+                                                         }
+                                                     });
+                           });
+        }
+
+        if constexpr (dim > 1)
+        {
+            EXPECT_GT(cached_mesh.stencil_index_cache(stencil.stencil)->size(), 0u);
+        }
+        EXPECT_EQ(mesh.stencil_index_cache(stencil.stencil), nullptr);
+    }
 }
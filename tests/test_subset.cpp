@@ -1,5 +1,8 @@
 #include <cstddef>
+#include <algorithm>
+#include <array>
 #include <filesystem>
+#include <mutex>
 #include <span>
 #include <tuple>
 
@@ -13,6 +16,7 @@
 #include <samurai/interval.hpp>
 #include <samurai/level_cell_array.hpp>
 #include <samurai/mr/mesh.hpp>
+#include <samurai/subset/cache.hpp>
 #include <samurai/subset/node.hpp>
 
 namespace samurai
@@ -1322,4 +1326,161 @@ namespace samurai
         EXPECT_TRUE(intersection(lca, translate(lca, translation)).empty());
     }
 
+    TEST(subset, materialize)
+    {
+        LevelCellArray<1> lca(1);
+        LevelCellArray<1> lca_other(1);
+        lca.add_interval_back({0, 16}, {});
+        lca_other.add_interval_back({4, 10}, {});
+
+        auto materialized = materialize(intersection(lca, lca_other).on(0));
+        EXPECT_EQ(materialized.level(), 0);
+        EXPECT_EQ(materialized.nb_cells(), 3);
+        EXPECT_EQ(materialized[0][0].start, 2);
+        EXPECT_EQ(materialized[0][0].end, 5);
+
+        SubsetCache<LevelCellArray<1>> cache;
+        std::size_t nb_evaluations = 0;
+        auto make_subset           = [&]()
+        {
+            ++nb_evaluations;
+            return intersection(lca, lca_other).on(0);
+        };
+        const auto& cached = cache.get("intersection", 0, make_subset);
+        EXPECT_EQ(cached, materialized);
+        cache.get("intersection", 0, make_subset);
+        EXPECT_EQ(nb_evaluations, 1);
+        EXPECT_EQ(cache.size(), 1);
+
+        cache.clear();
+        cache.get("intersection", 0, make_subset);
+        EXPECT_EQ(nb_evaluations, 2);
+    }
+
+    TEST(subset, parallel_apply)
+    {
+        Box<int, 3> box1{
+            {0,  0,  0 },
+            {16, 12, 10}
+        };
+        Box<int, 3> box2{
+            {4,  2,  3},
+            {20, 8, 14}
+        };
+        LevelCellArray<3> lca1(4, box1);
+        LevelCellArray<3> lca2(4, box2);
+
+        using row_t = std::array<int, 4>;
+        auto collect = [](std::vector<row_t>& rows, std::mutex& mutex)
+        {
+            return [&](const auto& i, const auto& index)
+            {
+                std::lock_guard lock(mutex);
+                rows.push_back({i.start, i.end, index[0], index[1]});
+            };
+        };
+
+        std::mutex mutex;
+        std::vector<row_t> expected;
+        std::vector<row_t> rows;
+        apply(difference(lca1, lca2).on(3), collect(expected, mutex));
+        apply<Run::Parallel>(difference(lca1, lca2).on(3), collect(rows, mutex));
+
+        std::sort(rows.begin(), rows.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(rows, expected);
+    }
+
+    TEST(subset, interval_kernels)
+    {
+        // same-level operands: the rows are computed by the merge kernels
+        auto in_a = [](int i, int j)
+        {
+            return (7 * i + 3 * j + 200) % 11 < 6;
+        };
+        auto in_b = [](int i, int j)
+        {
+            return (5 * i + 2 * j + 200) % 9 < 4 || (i > 5 && i < 12);
+        };
+        auto make_lca = [](auto&& predicate)
+        {
+            LevelCellArray<2> lca(5);
+            for (int j = -20; j < 20; ++j)
+            {
+                for (int i = -20; i < 20; ++i)
+                {
+                    if (predicate(i, j))
+                    {
+                        lca.add_point_back(i, {j});
+                    }
+                }
+            }
+            return lca;
+        };
+
+        auto lca_a = make_lca(in_a);
+        auto lca_b = make_lca(in_b);
+
+        auto expected_intersection = make_lca(
+            [&](int i, int j)
+            {
+                return in_a(i, j) && in_b(i, j);
+            });
+        auto expected_union = make_lca(
+            [&](int i, int j)
+            {
+                return in_a(i, j) || in_b(i, j);
+            });
+        auto expected_difference = make_lca(
+            [&](int i, int j)
+            {
+                return in_a(i, j) && !in_b(i, j);
+            });
+
+        EXPECT_EQ(LevelCellArray<2>(intersection(lca_a, lca_b)), expected_intersection);
+        EXPECT_EQ(LevelCellArray<2>(union_(lca_a, lca_b)), expected_union);
+        EXPECT_EQ(LevelCellArray<2>(difference(lca_a, lca_b)), expected_difference);
+        EXPECT_EQ(LevelCellArray<2>(difference(lca_b, lca_a)).nb_cells(), lca_b.nb_cells() - expected_intersection.nb_cells());
+
+        // long rows of small intervals: the intervals ending before the other operand are skipped by blocks
+        auto in_c = [](int i, int)
+        {
+            return i % 2 == 0;
+        };
+        auto in_d = [](int i, int j)
+        {
+            return i >= 7 + j && i < 31 + j;
+        };
+        auto make_long_lca = [](auto&& predicate)
+        {
+            LevelCellArray<2> lca(7);
+            for (int j = 0; j < 4; ++j)
+            {
+                for (int i = -100; i < 100; ++i)
+                {
+                    if (predicate(i, j))
+                    {
+                        lca.add_point_back(i, {j});
+                    }
+                }
+            }
+            return lca;
+        };
+
+        auto lca_c = make_long_lca(in_c);
+        auto lca_d = make_long_lca(in_d);
+        EXPECT_EQ(LevelCellArray<2>(intersection(lca_c, lca_d)),
+                  make_long_lca(
+                      [&](int i, int j)
+                      {
+                          return in_c(i, j) && in_d(i, j);
+                      }));
+        EXPECT_EQ(LevelCellArray<2>(difference(lca_d, lca_c)),
+                  make_long_lca(
+                      [&](int i, int j)
+                      {
+                          return in_d(i, j) && !in_c(i, j);
+                      }));
+    }
 }
@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+namespace samurai
+{
+    // du/dt + u = 0 with u(0) = 1, integrated up to t = 1 with dt, dt/2 and dt/4:
+    // the error with respect to exp(-1) must decrease with the order of the method.
+    TEST(time_integrators, convergence_order_on_linear_decay)
+    {
+        static constexpr std::size_t dim = 1;
+
+        using box_t   = Box<double, dim>;
+        auto mesh_cfg = mesh_config<dim>().min_level(3).max_level(3);
+        auto mesh     = mra::make_mesh(box_t{{0.}, {1.}}, mesh_cfg);
+        auto u        = make_scalar_field<double>("u", mesh);
+
+        auto id = make_identity<decltype(u)>();
+
+        for (auto method : {RungeKuttaMethod::ForwardEuler,
+                            RungeKuttaMethod::SSPRK2,
+                            RungeKuttaMethod::SSPRK3,
+                            RungeKuttaMethod::RK4,
+                            RungeKuttaMethod::LowStorageRK4})
+        {
+            auto rk = make_explicit_runge_kutta(id, u, method);
+
+            std::array<double, 3> errors;
+            for (std::size_t refinement = 0; refinement < errors.size(); ++refinement)
+            {
+                const std::size_t n_steps = std::size_t{10} << refinement;
+                const double dt           = 1. / static_cast<double>(n_steps);
+
+                u.fill(1.);
+                for (std::size_t n = 0; n < n_steps; ++n)
+                {
+                    rk.step(dt);
+                }
+
+                errors[refinement] = 0;
+                for_each_cell(mesh,
+                              [&](const auto& cell)
+                              {
+                                  errors[refinement] = std::max(errors[refinement], std::abs(u[cell] - std::exp(-1.)));
+                              });
+            }
+
+            for (std::size_t refinement = 0; refinement + 1 < errors.size(); ++refinement)
+            {
+                double observed_order = std::log2(errors[refinement] / errors[refinement + 1]);
+                EXPECT_NEAR(observed_order, static_cast<double>(rk.order()), 0.1) << "method " << static_cast<int>(method);
+            }
+        }
+    }
+}